@@ -20,6 +20,7 @@ import { useWeatherDummy } from './api/weather-dummy'
 import { useGCalendarDummy } from './api/gcalendar-dummy'
 import { useVaultApi } from './api/vault'
 import { useVaultDummy } from './api/vault-dummy'
+import { Telemetry, type GhostHistory } from './lib/telemetry'
 
 
 // Register global fonts
@@ -82,20 +83,25 @@ function getSleepMinutes() {
 
 
 // Rendering!
+async function readTotd() {
+  const totd = await fs.readFile(
+    path.join(import.meta.dirname, '..', 'credentials', 'totd.json'),
+    'utf-8'
+  ).catch(() => null)
+  return Promise.try(() => JSON.parse(totd ?? '')).catch(() => null)
+}
+
 async function drawScreen(opts: {
   localTemperature?: number | string,
   totdOverride?: Record<string, any>,
   faceOverride?: string,
+  gray?: boolean,
 }) {
   await weather.assertRecentData().catch(consola.error)
   await calendar.assertRecentData().catch(consola.error)
   await holidays.assertRecentData().catch(consola.error)
 
-  const totd = await fs.readFile(
-    path.join(import.meta.dirname, '..', 'credentials', 'totd.json'),
-    'utf-8'
-  ).catch(() => null)
-  const totdData = await Promise.try(() => JSON.parse(totd ?? '')).catch(() => null)
+  const totdData = await readTotd()
   if (opts.totdOverride) {
     for (const [k, v] of Object.entries(opts.totdOverride)) {
       if (v !== undefined)
@@ -113,36 +119,85 @@ async function drawScreen(opts: {
     holidays,
     vault,
     quote: totdData,
-    localTemperature: opts.localTemperature
+    localTemperature: opts.localTemperature,
+    gray: opts.gray
   })
 }
 
 
+// Device logs, drained on request
+const logDrainRequested: Set<string> = new Set()
+
+// Refresh mode forced for the next full update, set on request
+const refreshRequested: Map<string, number> = new Map()
+const lastLogs: Map<string, string> = new Map()
+
+
 // Caching
 const lastImage: Map<string, Buffer> = new Map()
+const lastGray: Map<string, Buffer> = new Map()
+const lastQuote: Map<string, string> = new Map()
 const lastUpdate: Map<string, number> = new Map()
 
-function packageOp(opcode: number, payload?: Buffer) {
+function packageOp(opcode: number, payload?: Buffer, refreshMode = Const.RefreshNormal) {
   const header = 0b11101 << 3
   const instruction = opcode & 0b111 // only last 3 bits
   const instructionBuffer = Buffer.from([ header | instruction ])
   const sleeptimeBuffer = Buffer.from([ getSleepMinutes() ])
-  consola.info(`Packaging operation ${opcode} with payload size ${payload?.length ?? 0} bytes`)
+  const refreshBuffer = Buffer.from([ refreshMode ])
+  consola.info(`Packaging operation ${opcode} (refresh mode ${refreshMode}) with payload size ${payload?.length ?? 0} bytes`)
   return payload
-    ? Buffer.concat([ instructionBuffer, sleeptimeBuffer, payload ])
-    : Buffer.concat([ instructionBuffer, sleeptimeBuffer ])
+    ? Buffer.concat([ instructionBuffer, sleeptimeBuffer, refreshBuffer, payload ])
+    : Buffer.concat([ instructionBuffer, sleeptimeBuffer, refreshBuffer ])
 }
 
-export async function buildCachedPackage(clientId: string, localTemperature?: string) {
-  const img = await drawScreen({ localTemperature })
-  const imgBuffer = await img.renderFullBw()
+// Gray frames are always full refreshes, partial updates only work on 1bpp images
+function buildGrayPackage(clientId: string, img: Awaited<ReturnType<typeof drawScreen>>) {
+  const grayBuffer = img.renderFullGray()
+
+  if (lastGray.has(clientId) && ImgDiff.areIdentical(lastGray.get(clientId)!, grayBuffer)) {
+    return packageOp(Const.OpNoop)
+  }
 
-  const needsFull = !lastUpdate.has(clientId) || lastUpdate.get(clientId) !== DatetimeUtils.getCurrentHour()
+  // the panel no longer shows the last bw image, the next bw frame has to be full
+  lastGray.set(clientId, grayBuffer)
+  lastImage.delete(clientId)
+  consola.info(`Gray frame: ${grayBuffer.byteLength} bytes, ${grayBuffer.byteLength / Math.ceil(Const.ScreenWidth * Const.ScreenHeight / 8)}x a bw frame`)
+  return packageOp(Const.OpGray, grayBuffer)
+}
+
+export async function buildCachedPackage(clientId: string, localTemperature?: string, ghost?: GhostHistory) {
+  // the slow full update cleans up ghosting, the device knows when it is due from its refresh history,
+  // devices that do not report it get one every hour. forced updates say which refresh they want
+  const needsFull = ghost
+    ? ghost.cleanDue
+    : !lastUpdate.has(clientId) || lastUpdate.get(clientId) !== DatetimeUtils.getCurrentHour()
   lastUpdate.set(clientId, DatetimeUtils.getCurrentHour())
+  const forcedRefresh = refreshRequested.get(clientId)
+  refreshRequested.delete(clientId)
+
+  // a gray frame costs twice a bw full frame and bypasses partials, so a gray quote photo only goes out
+  // with a new quote or when a full refresh is due anyway. other changes of the face are sent in bw
+  const quote = JSON.stringify(await readTotd())
+  const grayAllowed = needsFull || forcedRefresh !== undefined || lastQuote.get(clientId) !== quote
+  lastQuote.set(clientId, quote)
+
+  let img = await drawScreen({ localTemperature, gray: true })
+  if (img.isGray()) {
+    if (grayAllowed)
+      return buildGrayPackage(clientId, img)
+    // the panel still shows the gray frame, keep it as long as nothing changed
+    if (lastGray.has(clientId) && ImgDiff.areIdentical(lastGray.get(clientId)!, img.renderFullGray()))
+      return packageOp(Const.OpNoop)
+    img = await drawScreen({ localTemperature, gray: false })
+  }
+
+  lastGray.delete(clientId)
+  const imgBuffer = await img.renderFullBw()
 
-  if (needsFull || !lastImage.has(clientId)) {
+  if (needsFull || !lastImage.has(clientId) || forcedRefresh !== undefined) {
     lastImage.set(clientId, imgBuffer)
-    return packageOp(Const.OpFull, imgBuffer)
+    return packageOp(Const.OpFull, imgBuffer, forcedRefresh ?? Const.RefreshNormal)
   }
 
   if (ImgDiff.areIdentical(lastImage.get(clientId)!, imgBuffer)) {
@@ -153,8 +208,9 @@ export async function buildCachedPackage(clientId: string, localTemperature?: st
   const bounds = ImgDiff.getBounds(diff, Const.ScreenWidth, Const.ScreenHeight)
   ImgDiff.rasterBounds(bounds)
   if (bounds.w * bounds.h > Const.MaxPixelsForPartialUpdate) {
+    // content changed too much for a partial, the fast waveform is enough until the next hourly clean up
     lastImage.set(clientId, imgBuffer)
-    return packageOp(Const.OpFull, imgBuffer)
+    return packageOp(Const.OpFull, imgBuffer, Const.RefreshFast)
   }
 
   const lastBuffer = lastImage.get(clientId)!
@@ -168,7 +224,7 @@ export async function buildCachedPackage(clientId: string, localTemperature?: st
   ImgDiff.copyBounds(imgBuffer, diffBuffer, 10 + lastBuffer.byteLength, bounds, Const.ScreenWidth)
 
   lastImage.set(clientId, imgBuffer)
-  return packageOp(Const.OpPart, diffBuffer)
+  return packageOp(Const.OpPart, diffBuffer, Const.RefreshPartial)
 }
 
 
@@ -177,23 +233,40 @@ const whId = '1402180487795183698'
 
 // Serversss!!!
 const app = express()
-app.get('/r', async (req, res) => {
+const handleRefresh: express.RequestHandler = async (req, res) => {
   const log = `Request from ${req.ip} with ${Object.entries(req.query).map(([k, v]) => `${k}=${v}`).join(', ')} - ${getSleepMinutes()}min sleep`
   consola.info(log)
   const clientId = req.query.client ? String(req.query.client) : 'default'
-  const localTemperature = req.query.temp ? String(req.query.temp) : undefined
+
+  const telemetry = Telemetry.parse(Buffer.isBuffer(req.body) ? req.body : Buffer.alloc(0))
+  const latestSample = Telemetry.latest(telemetry)
+  if (telemetry.samples.length)
+    consola.info(`Telemetry: ${telemetry.samples.length} samples, latest ${latestSample!.temperature}°C ${latestSample!.pressure}Pa`)
+  if (telemetry.profile)
+    consola.info(`Last wake: ${Object.entries(telemetry.profile.phases).map(([k, v]) => `${k} ${v}ms (${telemetry.profile!.phasesLowClock[k]}ms low)`).join(', ')}; wifi ${telemetry.profile.wifiAttempts.map(a => `${a.ms}ms (${a.reason})`).join(', ')}`)
+
+  if (telemetry.ghost)
+    consola.info(`Panel since clean refresh: ${telemetry.ghost.partials} partials (${telemetry.ghost.coldPartials} cold), ${telemetry.ghost.fastFulls} fast, ${telemetry.ghost.pixels}px, ${telemetry.ghost.minutes}min${telemetry.ghost.cleanDue ? ', clean refresh due' : ''}`)
+
+  const localTemperature = latestSample
+    ? latestSample.temperature.toFixed(2)
+    : req.query.temp ? String(req.query.temp) : undefined
 
   axios.post(`https://discord.com/api/webhooks/${whId}/${whToken}`, { content: log, username: `${os.hostname()} + (${clientId})` })
 
   const start = Date.now()
-  const payload = await buildCachedPackage(clientId, localTemperature)
+  const payload = await buildCachedPackage(clientId, localTemperature, telemetry.ghost)
   const resTime = Date.now() - start
   consola.info(`Completed in ${resTime}ms`)
+  if (logDrainRequested.delete(clientId))
+    res.setHeader('X-Log-Drain', '1')
   res.send(payload)
 
   const log2 = `➥ Completed in ${resTime}ms with opcode ${payload[0] & 0b111}`
   axios.post(`https://discord.com/api/webhooks/${whId}/${whToken}`, { content: log2, username: `${os.hostname()} + (${clientId})` })
-})
+}
+app.get('/r', handleRefresh)
+app.post('/r', express.raw({ type: 'application/octet-stream', limit: '16kb' }), handleRefresh)
 app.get('/', async (req, res) => {
   const log = `View from ${req.ip} with ${Object.entries(req.query).map(([k, v]) => `${k}=${v}`).join(', ')} - ${getSleepMinutes()}min sleep`
   consola.info(log)
@@ -207,14 +280,35 @@ app.get('/', async (req, res) => {
       text: req.query.text !== undefined ? String(req.query.text) : undefined,
       image: req.query.image !== undefined ? String(req.query.image) : undefined
     },
-    faceOverride: req.query.face ? String(req.query.face) : undefined
+    faceOverride: req.query.face ? String(req.query.face) : undefined,
+    gray: true
   })
-  const imgBuffer = await img.exportFullBw()
+  const imgBuffer = img.isGray()
+    ? await img.exportFullGray()
+    : await img.exportFullBw()
   consola.info(`Completed in ${Date.now() - start}ms`)
 
   res.setHeader('Content-Type', 'image/png')
   res.send(imgBuffer)
 })
+app.get('/logs', (req, res) => {
+  const clientId = req.query.client ? String(req.query.client) : 'default'
+  logDrainRequested.add(clientId)
+  res.type('text/plain').send(lastLogs.get(clientId) ?? 'No logs yet, requested with the next refresh.')
+})
+app.get('/refresh', (req, res) => {
+  const clientId = req.query.client ? String(req.query.client) : 'default'
+  const mode = req.query.mode === 'fast' ? Const.RefreshFast : Const.RefreshNormal
+  refreshRequested.set(clientId, mode)
+  res.type('text/plain').send(`Full ${mode === Const.RefreshFast ? 'fast' : 'normal'} refresh requested with the next update.`)
+})
+app.post('/l', express.text({ limit: '64kb' }), (req, res) => {
+  const clientId = req.query.client ? String(req.query.client) : 'default'
+  const text = typeof req.body === 'string' ? req.body : ''
+  consola.info(`Received ${text.split('\n').filter(Boolean).length} log lines from ${clientId}`)
+  lastLogs.set(clientId, text)
+  res.sendStatus(204)
+})
 app.get('/discord-manual', () => disco.badaboom())
 app.get('/gcalendar-callback', (req, res) => {
   const code = req.query.code
@@ -10,6 +10,13 @@ export namespace Const {
   export const OpNoop = 0b000 // no operation
   export const OpFull = 0b001 // full update
   export const OpPart = 0b010 // partial update
+  export const OpGray = 0b011 // full update in 4 gray levels, 2 bits per pixel
+
+  export const GrayLevels = 4
+
+  export const RefreshNormal = 0 // slow full refresh, clears ghosting
+  export const RefreshFast = 1 // fast full refresh
+  export const RefreshPartial = 2 // partial refresh of the bounding box
 
   export const FullscreenTriggerWords = [
     'fullscreen',
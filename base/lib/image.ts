@@ -27,12 +27,18 @@ export type Renderer <Return extends RenderReturn> = (img: {
   height: number
 }) => Return | Promise<Return>
 
+/** nearest gray level of a luminance, 0 black to Const.GrayLevels - 1 white */
+function grayLevel(value: number) {
+  return Math.floor((value * (Const.GrayLevels - 1) + 127) / 255)
+}
+
 export const useImage = (ScreenWidth = Const.ScreenWidth, ScreenHeight = Const.ScreenHeight) => {
   const canvas = createCanvas(ScreenWidth, ScreenHeight)
   const ctx = canvas.getContext('2d')
 
   ctx.fillStyle = 'white'
   ctx.fillRect(0, 0, ScreenWidth, ScreenHeight)
+  let gray = false
 
   async function draw<Return extends RenderReturn>(renderer: Renderer<Return>, frameX?: number, frameY?: number, frameWidth?: number, frameHeight?: number) {
     const paint = usePaint(ctx, frameX, frameY, frameWidth, frameHeight)
@@ -62,9 +68,16 @@ export const useImage = (ScreenWidth = Const.ScreenWidth, ScreenHeight = Const.S
         .render('white')
     }
     paint.render(true)
+    if (paint.hasGray())
+      gray = true
     return returnValue
   }
 
+  /** whether a renderer drew gray levels, the frame then goes out with renderFullGray */
+  function isGray() {
+    return gray
+  }
+
   /** render full as black and white, 1 bit per pixel */
   function renderFullBw() {
     const buff = Buffer.alloc(Math.ceil(ScreenWidth * ScreenHeight / 8))
@@ -81,6 +94,22 @@ export const useImage = (ScreenWidth = Const.ScreenWidth, ScreenHeight = Const.S
     return buff
   }
 
+  /** render full in Const.GrayLevels levels, 2 bits per pixel, leftmost pixel in the top bits, 0 black to 3 white */
+  function renderFullGray() {
+    const buff = Buffer.alloc(Math.ceil(ScreenWidth * ScreenHeight / 4))
+    const imageData = ctx.getImageData(0, 0, ScreenWidth, ScreenHeight).data
+
+    let byte = 0
+    for (let i = 0; i < ScreenWidth * ScreenHeight; i += 4) {
+      byte = 0
+      for (let j = 0; j < 4; j++) {
+        byte |= grayLevel(imageData[(i+j)*4]) << (6 - j*2)
+      }
+      buff[~~(i/4)] = byte
+    }
+    return buff
+  }
+
   /** render full as black and white, 1 bit per pixel */
   async function exportFullBw(filename?: string) {
     const exportCanvas = createCanvas(ScreenWidth, ScreenHeight)
@@ -103,12 +132,37 @@ export const useImage = (ScreenWidth = Const.ScreenWidth, ScreenHeight = Const.S
     return exportPng
   }
 
+  /** render full in Const.GrayLevels levels, as the panel shows a gray frame */
+  async function exportFullGray(filename?: string) {
+    const exportCanvas = createCanvas(ScreenWidth, ScreenHeight)
+    const exportCtx = exportCanvas.getContext('2d')
+
+    const imageDataContainer = ctx.getImageData(0, 0, ScreenWidth, ScreenHeight)
+    const imageData = imageDataContainer.data
+    let val = 0
+    for (let i = 0; i < ScreenWidth * ScreenHeight; i++) {
+      val = Math.round(grayLevel(imageData[i*4]) * 255 / (Const.GrayLevels - 1))
+      imageData[i*4] = val
+      imageData[i*4+1] = val
+      imageData[i*4+2] = val
+    }
+
+    exportCtx.putImageData(imageDataContainer, 0, 0)
+    const exportPng = await exportCanvas.encode('png')
+    if (filename)
+      await promises.writeFile(join(import.meta.dirname, '..', '..', 'output', filename), exportPng)
+    return exportPng
+  }
+
   return {
     [RawCtx]: ctx,
     width: ScreenWidth,
     height: ScreenHeight,
     draw,
+    isGray,
     renderFullBw,
-    exportFullBw
+    exportFullBw,
+    renderFullGray,
+    exportFullGray
   }
 }
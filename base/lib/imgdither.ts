@@ -3,6 +3,7 @@ import sharp from "sharp"
 import type { usePaint } from "./paint"
 import path from "path"
 import * as fs from 'fs/promises'
+import { Const } from "./const"
 
 const bayerMatrix = [
   [0, 48, 12, 60, 3, 51, 15, 63],
@@ -48,7 +49,13 @@ export function orderedDither<T extends Buffer | Uint8Array>(imageData: T, width
   return imageData
 }
 
-export function errorDiffusionDither<T extends Buffer | Uint8Array>(imageData: T, width: number, height: number, scale = 1): T {
+/** nearest of `levels` evenly spaced values from 0 to 255 */
+function quantize(value: number, levels: number) {
+  const level = Math.max(0, Math.min(levels - 1, Math.floor((value * (levels - 1) + 127) / 255)))
+  return Math.round(level * 255 / (levels - 1))
+}
+
+export function errorDiffusionDither<T extends Buffer | Uint8Array>(imageData: T, width: number, height: number, scale = 1, levels = 2): T {
   const isBuffer = Buffer.isBuffer(imageData)
   const toneScale = Math.max(0, scale)
   const pixelCount = width * height
@@ -72,7 +79,7 @@ export function errorDiffusionDither<T extends Buffer | Uint8Array>(imageData: T
     for (let x = 0; x < width; x++) {
       const i = y * width + x
       const current = work[i]
-      const value = current >= 128 ? 255 : 0
+      const value = quantize(current, levels)
       const error = current - value
       work[i] = value
 
@@ -93,20 +100,20 @@ export function errorDiffusionDither<T extends Buffer | Uint8Array>(imageData: T
 
   if (isBuffer) {
     for (let i = 0; i < pixelCount; i++) {
-      const value = work[i] >= 128 ? 255 : 0
+      const value = quantize(work[i], levels)
       const dst = i * 3
       imageData[dst] = imageData[dst + 1] = imageData[dst + 2] = value
     }
   } else {
     for (let i = 0; i < pixelCount; i++) {
-      imageData[i] = work[i] >= 128 ? 255 : 0
+      imageData[i] = quantize(work[i], levels)
     }
   }
 
   return imageData
 }
 
-export async function loadAndDitherImage(url: string, maxWidth: number, maxHeight: number, fit: 'cover' | 'contain' = 'contain', mode: 'ordered' | 'error-diffusion' = 'ordered') {
+export async function loadAndDitherImage(url: string, maxWidth: number, maxHeight: number, fit: 'cover' | 'contain' = 'contain', mode: 'ordered' | 'error-diffusion' | 'gray' = 'ordered') {
   let data: Buffer
   if (!url.startsWith('http')) {
     // local file
@@ -133,9 +140,12 @@ export async function loadAndDitherImage(url: string, maxWidth: number, maxHeigh
     .resize(width, height, { kernel: 'lanczos3', fit: 'cover' })
     .modulate({ brightness: 1.1, saturation: 1.1 })
     .sharpen(1, 1, 3)
-  const dithered = mode === 'error-diffusion'
-    ? errorDiffusionDither(await scaled.removeAlpha().raw().toBuffer(), width, height)
-    : orderedDither(await scaled.removeAlpha().raw().toBuffer(), width, height)
+  const raw = await scaled.removeAlpha().raw().toBuffer()
+  const dithered = mode === 'gray'
+    ? errorDiffusionDither(raw, width, height, 1, Const.GrayLevels)
+    : mode === 'error-diffusion'
+      ? errorDiffusionDither(raw, width, height)
+      : orderedDither(raw, width, height)
   return { dithered, width, height }
 }
 
@@ -165,10 +175,9 @@ function checkBr(x: number, y: number, rectW: number, rectH: number, br: number)
 export async function drawDitheredImage(buffer: Buffer, width: number, height: number, paint: ReturnType<typeof usePaint>, round = 0) {
   for (let y = 0; y < height; y++) {
     for (let x = 0; x < width; x++) {
-      const black = buffer[(y * width + x) * 3] > 128
       if (round !== 0 && checkBr(x, y, width, height, round))
         continue
-      paint.setPixel(x, y, black ? 1 : 0)
+      paint.setGray(x, y, buffer[(y * width + x) * 3])
     }
   }
 }
@@ -60,11 +60,13 @@ function rotatePoint(x: number, y: number, angle: number, cx: number, cy: number
 
 export const usePaint = (ctx: SKRSContext2D, startX = 0, startY = 0, screenWidth = ctx.canvas.width, screenHeight = ctx.canvas.height) => {
   const imgData = ctx.getImageData(startX, startY, screenWidth, screenHeight)
+  // luminance per pixel, so gray drawn by an earlier frame survives this one
   const data = new Uint8Array(screenWidth * screenHeight)
   for (let i = 0; i < (screenWidth * screenHeight); i++)
-    data[i] = imgData.data[i*4] >= 128 ? 1 : 0
+    data[i] = imgData.data[i*4]
 
   let changes = false
+  let gray = false
 
   const global = {
     translateX: 0,
@@ -81,14 +83,32 @@ export const usePaint = (ctx: SKRSContext2D, startX = 0, startY = 0, screenWidth
 
     if (mix === 'invert') {
       if (value === 1) return
-      data[~~y * screenWidth + ~~x] = 1 - data[~~y * screenWidth + ~~x]
+      data[~~y * screenWidth + ~~x] = 255 - data[~~y * screenWidth + ~~x]
     } else {
-      data[~~y * screenWidth + ~~x] = value
+      data[~~y * screenWidth + ~~x] = value * 255
     }
 
     changes = true
   }
 
+  /** set a gray level, 0 black to 255 white, only shown as such in gray frames */
+  function setGray(x: number, y: number, value: number) {
+    x += global.translateX
+    y += global.translateY
+    if (y < 0 || y >= screenHeight || x < 0 || x >= screenWidth) return
+
+    data[~~y * screenWidth + ~~x] = value
+    if (value !== 0 && value !== 255)
+      gray = true
+
+    changes = true
+  }
+
+  /** whether setGray drew levels between black and white */
+  function hasGray() {
+    return gray
+  }
+
   function newRect(fromX = 0, fromY = 0, width = 1, height = 1, br = 0) {
     const rect = {
       x: fromX,
@@ -839,9 +859,9 @@ export const usePaint = (ctx: SKRSContext2D, startX = 0, startY = 0, screenWidth
   function render(onlyIfChanges = false) {
     if (onlyIfChanges && !changes) return
     for (let i = 0; i < data.length; i++) {
-      imgData.data[i*4] = data[i] * 255
-      imgData.data[i*4+1] = data[i] * 255
-      imgData.data[i*4+2] = data[i] * 255
+      imgData.data[i*4] = data[i]
+      imgData.data[i*4+1] = data[i]
+      imgData.data[i*4+2] = data[i]
       imgData.data[i*4+3] = 255
     }
     ctx.putImageData(imgData, startX, startY)
@@ -862,6 +882,8 @@ export const usePaint = (ctx: SKRSContext2D, startX = 0, startY = 0, screenWidth
     transform,
     clearTransform,
     setPixel,
+    setGray,
+    hasGray,
     newRect,
     newDisc,
     newText,
@@ -0,0 +1,138 @@
+
+export type SensorSample = {
+  /** minutes between taking the sample and uploading it */
+  age: number
+  /** degrees celsius */
+  temperature: number
+  /** pascal */
+  pressure: number
+}
+
+export type WifiAttempt = {
+  ms: number
+  /** esp-idf disconnect reason, 0 = got ip, 255 = timed out */
+  reason: number
+}
+
+export type WakeProfile = {
+  /** milliseconds spent per phase of the previous connected wake */
+  phases: Record<string, number>
+  /** part of each phase spent at the low cpu clock */
+  phasesLowClock: Record<string, number>
+  wifiAttempts: WifiAttempt[]
+}
+
+export type GhostHistory = {
+  /** the device saw every refresh since the last clean one */
+  known: boolean
+  /** the device asks for a clean (slow full) refresh */
+  cleanDue: boolean
+  partials: number
+  /** partials drawn in the cold, they leave more ghosting */
+  coldPartials: number
+  fastFulls: number
+  /** pixels changed by partials */
+  pixels: number
+  /** minutes since the last clean refresh */
+  minutes: number
+}
+
+export type TelemetryReport = {
+  version: number
+  sensorMode?: number
+  samples: SensorSample[]
+  profile?: WakeProfile
+  ghost?: GhostHistory
+}
+
+export namespace Telemetry {
+
+  export const SectionSensor = 0x01
+  export const SectionProfile = 0x02
+  export const SectionGhost = 0x03
+
+  export const ProfilePhases = [ 'boot', 'wifi', 'http', 'stream', 'refresh', 'sleep' ]
+
+  export const SensorRecordSize = 6
+  export const SensorPressureBase = 50_000
+
+  function parseSensor(data: Buffer, report: TelemetryReport) {
+    report.sensorMode = data.readUInt8(0)
+    const count = data.readUInt8(1)
+    for (let i = 0; i < count; i++) {
+      const offset = 2 + i * SensorRecordSize
+      if (offset + SensorRecordSize > data.length)
+        break
+      report.samples.push({
+        age: data.readUInt16BE(offset),
+        temperature: data.readInt16BE(offset + 2) / 100,
+        pressure: data.readUInt16BE(offset + 4) + SensorPressureBase
+      })
+    }
+  }
+
+  function parseProfile(data: Buffer, report: TelemetryReport) {
+    const profile: WakeProfile = { phases: {}, phasesLowClock: {}, wifiAttempts: [] }
+    const phaseCount = data.readUInt8(0)
+    for (let i = 0; i < phaseCount; i++) {
+      profile.phases[ProfilePhases[i] ?? `phase${i}`] = data.readUInt32BE(1 + i * 8)
+      profile.phasesLowClock[ProfilePhases[i] ?? `phase${i}`] = data.readUInt32BE(1 + i * 8 + 4)
+    }
+
+    let pos = 1 + phaseCount * 8
+    const attempts = data.readUInt8(pos++)
+    for (let i = 0; i < attempts && pos + 3 <= data.length; i++, pos += 3)
+      profile.wifiAttempts.push({ ms: data.readUInt16BE(pos), reason: data.readUInt8(pos + 2) })
+
+    report.profile = profile
+  }
+
+  export const GhostRecordSize = 14
+
+  function parseGhost(data: Buffer, report: TelemetryReport) {
+    if (data.length < GhostRecordSize)
+      return
+    const flags = data.readUInt8(0)
+    report.ghost = {
+      known: (flags & 0x01) !== 0,
+      cleanDue: (flags & 0x02) !== 0,
+      partials: data.readUInt16BE(1),
+      coldPartials: data.readUInt16BE(3),
+      fastFulls: data.readUInt8(5),
+      pixels: data.readUInt32BE(6),
+      minutes: data.readUInt32BE(10)
+    }
+  }
+
+  /** parse the binary request body sent by the device */
+  export function parse(body: Buffer): TelemetryReport {
+    const report: TelemetryReport = { version: 0, samples: [] }
+    if (!body || body.length < 1)
+      return report
+
+    report.version = body.readUInt8(0)
+    let pos = 1
+    while (pos + 3 <= body.length) {
+      const type = body.readUInt8(pos)
+      const len = body.readUInt16BE(pos + 1)
+      const data = body.subarray(pos + 3, pos + 3 + len)
+      pos += 3 + len
+
+      if (type === SectionSensor)
+        parseSensor(data, report)
+      else if (type === SectionProfile)
+        parseProfile(data, report)
+      else if (type === SectionGhost)
+        parseGhost(data, report)
+    }
+    return report
+  }
+
+  /** the most recent sample, if any */
+  export function latest(report: TelemetryReport): SensorSample | undefined {
+    return report.samples.length
+      ? report.samples.reduce((a, b) => (b.age < a.age ? b : a))
+      : undefined
+  }
+
+}
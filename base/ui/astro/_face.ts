@@ -20,6 +20,7 @@ export async function createAstroFace(opts: {
   vault: VaultApi,
   quote?: QuoteContent,
   localTemperature?: number | string,
+  gray?: boolean,
 }) {
   const hLineHeight = 2
   const dayviewHeight = 100
@@ -61,7 +62,7 @@ export async function createAstroFace(opts: {
   if (totdData) {
     if (totdFullscreen) {
       await img.draw(
-        drawQuote(totdData, true),
+        drawQuote(totdData, true, opts.gray),
         0, 0,
         Const.ScreenWidth, Const.ScreenHeight - dayHeight
       )
@@ -10,7 +10,8 @@ export type QuoteContent = {
 
 const padding = 10
 
-export function drawQuote(content: QuoteContent, fullscreen: boolean): Renderer<{ usedWidth: number }> {
+/** gray dithers a fullscreen photo to Const.GrayLevels levels, the frame then goes out as a 4-gray full refresh */
+export function drawQuote(content: QuoteContent, fullscreen: boolean, gray = false): Renderer<{ usedWidth: number }> {
   return async ({ paint, width, height }) => {
     paint.newRect(0, 0, width, height)
       .fill('white')
@@ -19,7 +20,7 @@ export function drawQuote(content: QuoteContent, fullscreen: boolean): Renderer<
     let usedWidth = width
 
     if (fullscreen && content.image) {
-      const { dithered } = await loadAndDitherImage(content.image, width, height, 'cover', 'error-diffusion')
+      const { dithered } = await loadAndDitherImage(content.image, width, height, 'cover', gray ? 'gray' : 'error-diffusion')
       await drawDitheredImage(dithered, width, height, paint)
     } else {
       const maxWidth = width - padding * 2
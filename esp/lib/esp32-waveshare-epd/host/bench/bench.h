@@ -0,0 +1,37 @@
+/*****************************************************************************
+* | File      	:   bench.h
+* | Function    :   Timing for the host benchmarks
+* | Info        :
+*   Each measurement is the best of a few runs, the host is not quiet
+*----------------
+******************************************************************************/
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include <chrono>
+
+#define BENCH_RUNS 5
+
+/******************************************************************************
+function: Time a piece of code
+parameter:
+    Count : Calls Body makes, the result is per call
+    Body  : Code to time
+info:
+    Returns nanoseconds per call, the best of BENCH_RUNS runs.
+******************************************************************************/
+template<class F>
+static double Bench_Time(long Count, F Body)
+{
+    double Best = 0;
+    for (int Run = 0; Run < BENCH_RUNS; Run++) {
+        auto Start = std::chrono::steady_clock::now();
+        Body();
+        double Ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / Count;
+        if (Run == 0 || Ns < Best)
+            Best = Ns;
+    }
+    return Best;
+}
+
+#endif
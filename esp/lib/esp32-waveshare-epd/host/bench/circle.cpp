@@ -0,0 +1,95 @@
+/*****************************************************************************
+* | File      	:   circle.cpp
+* | Function    :   Paint_DrawCircle against 8-point stamping
+* | Info        :
+*   Discs and rings at the center of an 800x480 canvas, drawn with the
+*   stamping loop Paint_DrawCircle used before the row spans and with
+*   Paint_DrawCircle. check/circle.cpp compares the two pixel for pixel.
+*----------------
+******************************************************************************/
+#include "GUI_Paint.h"
+#include "bench.h"
+
+#define WIDTH 800
+#define HEIGHT 480
+#define CIRCLES 50
+
+static UBYTE Image[WIDTH * HEIGHT / 8];
+
+typedef struct {
+    const char *Name;
+    UWORD Radius;
+    DOT_PIXEL Line_width;
+    DRAW_FILL Draw_Fill;
+} CIRCLE_CASE;
+
+/******************************************************************************
+function: Paint_DrawCircle before the row spans
+******************************************************************************/
+static void Stamped_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                               UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    int16_t XCurrent = 0, YCurrent = Radius;
+    int16_t Esp = 3 - (Radius << 1);
+    while (XCurrent <= YCurrent) {
+        if (Draw_Fill == DRAW_FILL_FULL) {
+            for (int16_t sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
+                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+            }
+        } else {
+            Paint_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Paint_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);
+        }
+        if (Esp < 0)
+            Esp += 4 * XCurrent + 6;
+        else {
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+}
+
+int main(void)
+{
+    const CIRCLE_CASE Cases[] = {
+        {"disc r20", 20, DOT_PIXEL_1X1, DRAW_FILL_FULL},
+        {"disc r100", 100, DOT_PIXEL_1X1, DRAW_FILL_FULL},
+        {"disc r200", 200, DOT_PIXEL_1X1, DRAW_FILL_FULL},
+        {"ring r20 w1", 20, DOT_PIXEL_1X1, DRAW_FILL_EMPTY},
+        {"ring r100 w1", 100, DOT_PIXEL_1X1, DRAW_FILL_EMPTY},
+        {"ring r100 w3", 100, DOT_PIXEL_3X3, DRAW_FILL_EMPTY},
+        {"ring r200 w5", 200, DOT_PIXEL_5X5, DRAW_FILL_EMPTY},
+    };
+
+    Paint_NewImage(Image, WIDTH, HEIGHT, ROTATE_0, WHITE);
+    Paint_SelectImage(Image);
+    Paint_Clear(WHITE);
+
+    printf("%-14s %10s %10s\n", "us per circle", "stamped", "spans");
+    for (const CIRCLE_CASE &C : Cases) {
+        double Before = Bench_Time(CIRCLES, [&] {
+            for (int i = 0; i < CIRCLES; i++)
+                Stamped_DrawCircle(WIDTH / 2, HEIGHT / 2, C.Radius, i & 1 ? BLACK : WHITE, C.Line_width, C.Draw_Fill);
+        });
+        double After = Bench_Time(CIRCLES, [&] {
+            for (int i = 0; i < CIRCLES; i++)
+                Paint_DrawCircle(WIDTH / 2, HEIGHT / 2, C.Radius, i & 1 ? BLACK : WHITE, C.Line_width, C.Draw_Fill);
+        });
+        printf("%-14s %10.2f %10.2f\n", C.Name, Before / 1000, After / 1000);
+    }
+    return 0;
+}
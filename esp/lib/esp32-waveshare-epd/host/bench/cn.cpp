@@ -0,0 +1,138 @@
+/*****************************************************************************
+* | File      	:   cn.cpp
+* | Function    :   Paint_DrawString_CN with and without the code point index
+* | Info        :
+*   Draws mixed-script calendar titles with Font24CN and with synthetic
+*   tables of 500 and 3000 entries in unsorted order, once through the
+*   index font-index.py generates and once with index NULL, the linear
+*   scan fonts without an index fall back to. Lookup alone is timed with
+*   an empty clip, which skips the glyph drawing. Both draws must come
+*   out the same.
+*----------------
+******************************************************************************/
+#include "GUI_Paint.h"
+#include "bench.h"
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define WIDTH 800
+#define HEIGHT 480
+
+static UBYTE Image[WIDTH * HEIGHT / 8];
+static UBYTE Reference[WIDTH * HEIGHT / 8];
+
+static const char *Titles[] = {
+    "Team \xe5\x91\xa8\xe4\xbc\x9a Q3 Planung",
+    "\xe5\x8d\x88\xe9\xa4\x90 mit Anna",
+    "Zahnarzt \xe7\x89\x99\xe5\x8c\xbb 14:00",
+    "\xe9\xa1\xb9\xe7\x9b\xae\xe8\xaf\x84\xe5\xae\xa1 - M\xc3\xbcller",
+    "\xe5\xae\xb6\xe9\x95\xbf\xe4\xbc\x9a / Elternabend",
+    "Standup",
+    "\xe7\x94\x9f\xe6\x97\xa5\xe6\xb4\xbe\xe5\xaf\xb9 \xf0\x9f\x8e\x82",
+    "Caf\xc3\xa9 \xe4\xb8\x8e \xe6\x9c\x8b\xe5\x8f\x8b",
+};
+#define TITLES (sizeof(Titles) / sizeof(Titles[0]))
+
+static void Encode_UTF8(uint32_t Code, unsigned char *Out)
+{
+    if (Code < 0x80) {
+        Out[0] = Code;
+        Out[1] = Out[2] = 0;
+    } else if (Code < 0x800) {
+        Out[0] = 0xC0 | Code >> 6;
+        Out[1] = 0x80 | (Code & 0x3F);
+        Out[2] = 0;
+    } else {
+        Out[0] = 0xE0 | Code >> 12;
+        Out[1] = 0x80 | ((Code >> 6) & 0x3F);
+        Out[2] = 0x80 | (Code & 0x3F);
+    }
+}
+
+/******************************************************************************
+function: A table of printable ASCII and spread out CJK ideographs
+parameter:
+    Size  : Entries
+    Font  : Receives the font, with its index
+info:
+    Entries are shuffled like a hand written table, the index is sorted.
+******************************************************************************/
+static void Synthetic_Font(int Size, cFONT *Font)
+{
+    CH_CN *Table = (CH_CN *)calloc(Size, sizeof(CH_CN));
+    CH_CN_INDEX *Index = (CH_CN_INDEX *)calloc(Size, sizeof(CH_CN_INDEX));
+    std::vector<uint32_t> Codes;
+    for (int i = 0; i < Size; i++)
+        Codes.push_back(i < 95 ? 0x20 + i : 0x4E00 + (uint32_t)((i - 95) * 7919 % 20902));
+    unsigned Seed = 1;
+    for (int i = Size - 1; i > 0; i--) {
+        Seed = Seed * 1103515245 + 12345;
+        std::swap(Codes[i], Codes[(Seed >> 8) % (i + 1)]);
+    }
+    for (int i = 0; i < Size; i++) {
+        Encode_UTF8(Codes[i], Table[i].index);
+        memset((char *)Table[i].matrix, 0x3C, sizeof(Table[i].matrix));
+        Index[i].code = Codes[i];
+        Index[i].entry = i;
+    }
+    std::sort(Index, Index + Size, [](const CH_CN_INDEX &A, const CH_CN_INDEX &B) { return A.code < B.code; });
+    *Font = {Table, (uint16_t)Size, 24, 32, 41, Index, (uint16_t)Size};
+}
+
+static void Draw_Titles(cFONT *Font)
+{
+    for (unsigned i = 0; i < TITLES; i++)
+        Paint_DrawString_CN(0, 10 + 50 * (i % 8), Titles[i], Font, BLACK, WHITE);
+}
+
+int main(void)
+{
+    cFONT Fonts[3] = {Font24CN};
+    const char *Names[3] = {"Font24CN", "500 entries", "3000 entries"};
+    Synthetic_Font(500, &Fonts[1]);
+    Synthetic_Font(3000, &Fonts[2]);
+    int Failed = 0;
+
+    Paint_NewImage(Image, WIDTH, HEIGHT, ROTATE_0, WHITE);
+    Paint_SelectImage(Image);
+
+    printf("%-14s %-7s %10s %10s\n", "us per title", "", "linear", "indexed");
+    for (int f = 0; f < 3; f++) {
+        cFONT Indexed = Fonts[f], Linear = Fonts[f];
+        Linear.index = NULL;
+        Linear.index_size = 0;
+        int Rounds = Fonts[f].size > 1000 ? 100 : 1000;
+
+        Paint_Clear(WHITE);
+        double DrawLinear = Bench_Time(Rounds * TITLES, [&] {
+            for (int r = 0; r < Rounds; r++)
+                Draw_Titles(&Linear);
+        });
+        memcpy(Reference, Image, sizeof(Image));
+        Paint_Clear(WHITE);
+        double DrawIndexed = Bench_Time(Rounds * TITLES, [&] {
+            for (int r = 0; r < Rounds; r++)
+                Draw_Titles(&Indexed);
+        });
+        bool Same = memcmp(Reference, Image, sizeof(Image)) == 0;
+        Failed += !Same;
+
+        Paint_PushClip(0, 0, 0, 0);
+        double FindLinear = Bench_Time(Rounds * TITLES, [&] {
+            for (int r = 0; r < Rounds; r++)
+                Draw_Titles(&Linear);
+        });
+        double FindIndexed = Bench_Time(Rounds * TITLES, [&] {
+            for (int r = 0; r < Rounds; r++)
+                Draw_Titles(&Indexed);
+        });
+        Paint_PopClip();
+
+        printf("%-14s %-7s %10.2f %10.2f\n", Names[f], "lookup", FindLinear / 1000, FindIndexed / 1000);
+        printf("%-14s %-7s %10.2f %10.2f%s\n", Names[f], "draw", DrawLinear / 1000, DrawIndexed / 1000,
+               Same ? "" : "  DIFFERENT");
+    }
+    return Failed ? 1 : 0;
+}
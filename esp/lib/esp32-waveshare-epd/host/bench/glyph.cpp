@@ -0,0 +1,87 @@
+/*****************************************************************************
+* | File      	:   glyph.cpp
+* | Function    :   Time per glyph of the firmware and raw pFONT tables
+* | Info        :
+*   Draws calendar titles with the fixed width sFONT of the same height,
+*   the raw pFONT font-pack.py --raw writes and the one the firmware uses,
+*   run length packed where FONTS asks for it. Both pFONT tables must
+*   draw the same pixels. make footprint prints the flash each table
+*   takes.
+*----------------
+******************************************************************************/
+#include "GUI_Paint.h"
+#include "bench.h"
+#include <string.h>
+
+#define WIDTH 800
+#define HEIGHT 480
+#define ROUNDS 2000
+
+extern pFONT FontNoto16Raw;
+extern pFONT FontNoto24Raw;
+
+static UBYTE Image[WIDTH * HEIGHT / 8];
+static UBYTE Reference[WIDTH * HEIGHT / 8];
+
+static const char *Titles[] = {
+    "Team Meeting Q3 Planung", "Mittagessen mit Anna", "Zahnarzt 14:00",
+    "Projektreview - Mueller", "Elternabend", "Kaffee mit Freunden",
+};
+#define TITLES (sizeof(Titles) / sizeof(Titles[0]))
+
+// ASCII only, so the sFONT draws the same glyphs
+static long Glyphs(void)
+{
+    long Count = 0;
+    for (unsigned i = 0; i < TITLES; i++)
+        Count += strlen(Titles[i]);
+    return Count * ROUNDS;
+}
+
+static double Time_Fixed(sFONT *Font)
+{
+    return Bench_Time(Glyphs(), [&] {
+        for (int r = 0; r < ROUNDS; r++)
+            for (unsigned i = 0; i < TITLES; i++)
+                Paint_DrawString_EN(r % 200, 40 * i, Titles[i], Font, WHITE, BLACK);
+    });
+}
+
+static double Time_Packed(pFONT *Font)
+{
+    return Bench_Time(Glyphs(), [&] {
+        for (int r = 0; r < ROUNDS; r++)
+            for (unsigned i = 0; i < TITLES; i++)
+                Paint_DrawText(r % 200, 40 * i, Titles[i], Font, BLACK, FONT_BACKGROUND);
+    });
+}
+
+int main(void)
+{
+    Paint_NewImage(Image, WIDTH, HEIGHT, ROTATE_0, WHITE);
+    Paint_SelectImage(Image);
+    int Failed = 0;
+
+    printf("%-14s %10s %10s %10s\n", "ns per glyph", "sFONT", "raw", "firmware");
+    struct {
+        const char *Name;
+        sFONT *Fixed;
+        pFONT *Raw, *Packed;
+    } Sizes[] = {
+        {"16 px", &Font16, &FontNoto16Raw, &FontNoto16},
+        {"24 px", &Font24, &FontNoto24Raw, &FontNoto24},
+    };
+    for (auto &S : Sizes) {
+        Paint_Clear(WHITE);
+        double Fixed = Time_Fixed(S.Fixed);
+        Paint_Clear(WHITE);
+        double Raw = Time_Packed(S.Raw);
+        memcpy(Reference, Image, sizeof(Image));
+        Paint_Clear(WHITE);
+        double Packed = Time_Packed(S.Packed);
+        bool Same = memcmp(Reference, Image, sizeof(Image)) == 0;
+        Failed += !Same;
+        printf("%-14s %10.1f %10.1f %10.1f%s\n", S.Name, Fixed, Raw, Packed, Same ? "" : "  DIFFERENT");
+    }
+    return Failed ? 1 : 0;
+}
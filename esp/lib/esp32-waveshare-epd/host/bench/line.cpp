@@ -0,0 +1,108 @@
+/*****************************************************************************
+* | File      	:   line.cpp
+* | Function    :   Paint_DrawLine per line type against point stamping
+* | Info        :
+*   Each case draws the same line with the Bresenham loop Paint_DrawLine
+*   used before its fast paths, one Paint_DrawPoint per step, and with
+*   Paint_DrawLine. Both buffers must come out the same.
+*----------------
+******************************************************************************/
+#include "GUI_Paint.h"
+#include "bench.h"
+#include <string.h>
+
+#define WIDTH 800
+#define HEIGHT 480
+#define LINES 200
+
+static UBYTE Image[WIDTH * HEIGHT / 8];
+static UBYTE Reference[WIDTH * HEIGHT / 8];
+
+typedef struct {
+    const char *Name;
+    UWORD Xstart, Ystart, Xend, Yend;
+    DOT_PIXEL Line_width;
+    LINE_STYLE Line_Style;
+} LINE_CASE;
+
+/******************************************************************************
+function: Paint_DrawLine before the span and mask fast paths
+******************************************************************************/
+static void Stamped_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                             UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+    int XAddway = Xstart < Xend ? 1 : -1;
+    int YAddway = Ystart < Yend ? 1 : -1;
+    int Esp = dx + dy;
+    char Dotted_Len = 0;
+
+    for (;;) {
+        Dotted_Len++;
+        if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
+            Paint_DrawPoint(Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
+            Dotted_Len = 0;
+        } else {
+            Paint_DrawPoint(Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
+        }
+        if (2 * Esp >= dy) {
+            if (Xpoint == Xend)
+                break;
+            Esp += dy;
+            Xpoint += XAddway;
+        }
+        if (2 * Esp <= dx) {
+            if (Ypoint == Yend)
+                break;
+            Esp += dx;
+            Ypoint += YAddway;
+        }
+    }
+}
+
+int main(void)
+{
+    const LINE_CASE Cases[] = {
+        {"hline w1", 10, 100, 790, 100, DOT_PIXEL_1X1, LINE_STYLE_SOLID},
+        {"hline w3", 10, 100, 790, 100, DOT_PIXEL_3X3, LINE_STYLE_SOLID},
+        {"vline w1", 100, 10, 100, 470, DOT_PIXEL_1X1, LINE_STYLE_SOLID},
+        {"vline w3", 100, 10, 100, 470, DOT_PIXEL_3X3, LINE_STYLE_SOLID},
+        {"diag w1", 10, 10, 470, 470, DOT_PIXEL_1X1, LINE_STYLE_SOLID},
+        {"slope w1", 10, 20, 790, 400, DOT_PIXEL_1X1, LINE_STYLE_SOLID},
+        {"slope w3", 10, 20, 790, 400, DOT_PIXEL_3X3, LINE_STYLE_SOLID},
+        {"slope w5", 10, 20, 790, 400, DOT_PIXEL_5X5, LINE_STYLE_SOLID},
+        {"dotted h w1", 10, 100, 790, 100, DOT_PIXEL_1X1, LINE_STYLE_DOTTED},
+        {"dotted h w3", 10, 100, 790, 100, DOT_PIXEL_3X3, LINE_STYLE_DOTTED},
+        {"dotted v w3", 100, 10, 100, 470, DOT_PIXEL_3X3, LINE_STYLE_DOTTED},
+        {"dotted slope", 10, 20, 790, 400, DOT_PIXEL_1X1, LINE_STYLE_DOTTED},
+    };
+    int Failed = 0;
+
+    Paint_NewImage(Image, WIDTH, HEIGHT, ROTATE_0, WHITE);
+    Paint_SelectImage(Image);
+
+    printf("%-14s %10s %10s\n", "us per line", "stamped", "DrawLine");
+    for (const LINE_CASE &L : Cases) {
+        // alternate the color so every line writes all its pixels, the last one black
+        Paint_Clear(WHITE);
+        double Before = Bench_Time(LINES, [&] {
+            for (int i = 0; i < LINES; i++)
+                Stamped_DrawLine(L.Xstart, L.Ystart, L.Xend, L.Yend, i & 1 ? BLACK : WHITE, L.Line_width, L.Line_Style);
+        });
+        memcpy(Reference, Image, sizeof(Image));
+
+        Paint_Clear(WHITE);
+        double After = Bench_Time(LINES, [&] {
+            for (int i = 0; i < LINES; i++)
+                Paint_DrawLine(L.Xstart, L.Ystart, L.Xend, L.Yend, i & 1 ? BLACK : WHITE, L.Line_width, L.Line_Style);
+        });
+        bool Same = memcmp(Reference, Image, sizeof(Image)) == 0;
+        Failed += !Same;
+
+        printf("%-14s %10.2f %10.2f%s\n", L.Name, Before / 1000, After / 1000, Same ? "" : "  DIFFERENT");
+    }
+    return Failed ? 1 : 0;
+}
@@ -0,0 +1,151 @@
+/*****************************************************************************
+* | File      	:   pixel.cpp
+* | Function    :   Per pixel cost of Paint_SetPixel and the pixel writers
+* | Info        :
+*   Paints a full 800x480 pattern pixel by pixel three ways: with a copy of
+*   the generic Paint_SetPixel the writers replaced, which resolves
+*   rotation, mirroring and scale on every call, with today's
+*   Paint_SetPixel, which also clips and marks the dirty area, and with the
+*   writer Paint_GetPixelWriter specializes for the canvas. All three
+*   buffers must come out the same.
+*----------------
+******************************************************************************/
+#include "GUI_Paint.h"
+#include "bench.h"
+#include <string.h>
+
+#define WIDTH 800
+#define HEIGHT 480
+
+static UBYTE Image[WIDTH * HEIGHT / 2];
+static UBYTE Reference[WIDTH * HEIGHT / 2];
+
+typedef struct {
+    UWORD Rotate;
+    UBYTE Mirror;
+    UBYTE Scale;
+} CONFIG;
+
+/******************************************************************************
+function: Paint_SetPixel before the specialized writers, on the Paint canvas
+******************************************************************************/
+static void Generic_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height)
+        return;
+    UWORD X, Y;
+    switch (Paint.Rotate) {
+    case 0:
+        X = Xpoint;
+        Y = Ypoint;
+        break;
+    case 90:
+        X = Paint.WidthMemory - Ypoint - 1;
+        Y = Xpoint;
+        break;
+    case 180:
+        X = Paint.WidthMemory - Xpoint - 1;
+        Y = Paint.HeightMemory - Ypoint - 1;
+        break;
+    case 270:
+        X = Ypoint;
+        Y = Paint.HeightMemory - Xpoint - 1;
+        break;
+    default:
+        return;
+    }
+
+    switch (Paint.Mirror) {
+    case MIRROR_NONE:
+        break;
+    case MIRROR_HORIZONTAL:
+        X = Paint.WidthMemory - X - 1;
+        break;
+    case MIRROR_VERTICAL:
+        Y = Paint.HeightMemory - Y - 1;
+        break;
+    case MIRROR_ORIGIN:
+        X = Paint.WidthMemory - X - 1;
+        Y = Paint.HeightMemory - Y - 1;
+        break;
+    default:
+        return;
+    }
+
+    if (X > Paint.WidthMemory || Y > Paint.HeightMemory)
+        return;
+
+    if (Paint.Scale == 2) {
+        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
+        UBYTE Rdata = Paint.Image[Addr];
+        if (Color == BLACK)
+            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
+        else
+            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
+    } else if (Paint.Scale == 4) {
+        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
+        Color = Color % 4;
+        UBYTE Rdata = Paint.Image[Addr] & (~(0xC0 >> ((X % 4) * 2)));
+        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4) * 2));
+    } else if (Paint.Scale == 7 || Paint.Scale == 16) {
+        UDOUBLE Addr = X / 2 + Y * Paint.WidthByte;
+        UBYTE Rdata = Paint.Image[Addr] & (~(0xF0 >> ((X % 2) * 4)));
+        Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2) * 4));
+    }
+}
+
+static UWORD Color_At(UBYTE Scale, UWORD X, UWORD Y)
+{
+    if (Scale == 2)
+        return (X ^ Y) & 1 ? BLACK : WHITE;
+    return (X + Y) % (Scale == 4 ? 4 : 7);
+}
+
+int main(void)
+{
+    const CONFIG Configs[] = {
+        {ROTATE_0, MIRROR_NONE, 2}, {ROTATE_90, MIRROR_NONE, 2}, {ROTATE_180, MIRROR_HORIZONTAL, 2},
+        {ROTATE_270, MIRROR_ORIGIN, 2}, {ROTATE_0, MIRROR_NONE, 4}, {ROTATE_0, MIRROR_NONE, 7},
+    };
+    const long Pixels = (long)WIDTH * HEIGHT;
+    int Failed = 0;
+
+    printf("%-22s %10s %10s %10s\n", "ns per pixel", "generic", "SetPixel", "writer");
+    for (const CONFIG &C : Configs) {
+        Paint_NewImage(Image, WIDTH, HEIGHT, C.Rotate, WHITE);
+        Paint_SelectImage(Image);
+        Paint_SetMirroring(C.Mirror);
+        Paint_SetScale(C.Scale);
+        UWORD Width = Paint.Width, Height = Paint.Height;
+
+        Paint_Clear(WHITE);
+        double Generic = Bench_Time(Pixels, [&] {
+            for (UWORD Y = 0; Y < Height; Y++)
+                for (UWORD X = 0; X < Width; X++)
+                    Generic_SetPixel(X, Y, Color_At(C.Scale, X, Y));
+        });
+        memcpy(Reference, Image, sizeof(Image));
+
+        Paint_Clear(WHITE);
+        double Checked = Bench_Time(Pixels, [&] {
+            for (UWORD Y = 0; Y < Height; Y++)
+                for (UWORD X = 0; X < Width; X++)
+                    Paint_SetPixel(X, Y, Color_At(C.Scale, X, Y));
+        });
+        bool Same = memcmp(Reference, Image, sizeof(Image)) == 0;
+
+        Paint_Clear(WHITE);
+        double After = Bench_Time(Pixels, [&] {
+            PAINT_PIXEL_WRITER SetPixel = Paint_GetPixelWriter();
+            for (UWORD Y = 0; Y < Height; Y++)
+                for (UWORD X = 0; X < Width; X++)
+                    SetPixel(&Paint, X, Y, Color_At(C.Scale, X, Y));
+        });
+        Same = Same && memcmp(Reference, Image, sizeof(Image)) == 0;
+        Failed += !Same;
+
+        printf("rotate %3d mirror %d x%d %10.2f %10.2f %10.2f%s\n", C.Rotate, C.Mirror, C.Scale,
+               Generic, Checked, After, Same ? "" : "  DIFFERENT");
+    }
+    return Failed ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+/*****************************************************************************
+* | File      	:   circle.cpp
+* | Function    :   Paint_DrawCircle and Paint_DrawRoundRect pixel for pixel
+* | Info        :
+*   Draws random circles with the 8-point stamping Paint_DrawCircle used
+*   before the row spans, and rounded rectangles built from those stamped
+*   discs and two fills, then the same shapes with the span code, over
+*   every rotation, mirroring and scale. Any difference is printed and
+*   fails the run. An optional argument seeds the shapes.
+*
+*   Shapes may reach past the canvas, where they are clipped like on a
+*   larger canvas. The stamping is done on a canvas padded by PAD pixels
+*   on each side and its middle compared, so points centered off the
+*   canvas still stamp their visible part.
+*----------------
+******************************************************************************/
+#include "GUI_Paint.h"
+#include <stdlib.h>
+
+#define SHAPES 300
+#define MAX_RADIUS 300
+#define PAD (MAX_RADIUS + 20)
+
+static UBYTE Image[128 * 128];
+static UBYTE Reference[(128 + 2 * PAD) * (128 + 2 * PAD) / 2];
+static PAINT Stamped;
+
+static unsigned Seed = 1;
+
+static int Random(int Range)
+{
+    Seed = Seed * 1103515245 + 12345;
+    return (Seed >> 8) % Range;
+}
+
+/******************************************************************************
+function: Compare the Paint canvas with the middle of the padded one
+info:
+    Padding bits after the last pixel of a row are left out.
+******************************************************************************/
+static bool Same_Pixels(void)
+{
+    int Bits = Paint.Scale == 2 ? 1 : Paint.Scale == 4 ? 2 : 4;
+    int PerByte = 8 / Bits;
+    for (UWORD Y = 0; Y < Paint.HeightMemory; Y++)
+        for (UWORD X = 0; X < Paint.WidthMemory; X++) {
+            UDOUBLE Addr = X / PerByte + Y * Paint.WidthByte;
+            UDOUBLE Ref = (X + PAD) / PerByte + (Y + PAD) * Stamped.WidthByte;
+            int Shift = (PerByte - 1 - X % PerByte) * Bits;
+            int RefShift = (PerByte - 1 - (X + PAD) % PerByte) * Bits;
+            if (((Image[Addr] >> Shift) ^ (Reference[Ref] >> RefShift)) & ((1 << Bits) - 1))
+                return false;
+        }
+    return true;
+}
+
+/******************************************************************************
+function: Paint_DrawCircle before the row spans
+******************************************************************************/
+static void Stamped_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                               UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PAINT *C = &Stamped;
+    int16_t XCurrent = 0, YCurrent = Radius;
+    int16_t Esp = 3 - (Radius << 1);
+    while (XCurrent <= YCurrent) {
+        if (Draw_Fill == DRAW_FILL_FULL) {
+            for (int16_t sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
+                Canvas_DrawPoint(C, X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Canvas_DrawPoint(C, X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Canvas_DrawPoint(C, X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Canvas_DrawPoint(C, X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Canvas_DrawPoint(C, X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Canvas_DrawPoint(C, X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Canvas_DrawPoint(C, X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Canvas_DrawPoint(C, X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+            }
+        } else {
+            Canvas_DrawPoint(C, X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Canvas_DrawPoint(C, X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Canvas_DrawPoint(C, X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Canvas_DrawPoint(C, X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Canvas_DrawPoint(C, X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Canvas_DrawPoint(C, X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Canvas_DrawPoint(C, X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);
+            Canvas_DrawPoint(C, X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);
+        }
+        if (Esp < 0)
+            Esp += 4 * XCurrent + 6;
+        else {
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+}
+
+/******************************************************************************
+function: A filled rounded rectangle from stamped corner discs
+info:
+    The stamped 1x1 points land up and left of their position, hence the
+    +1 on the disc centers.
+******************************************************************************/
+static void Stamped_FillRoundRect(int Xstart, int Ystart, int Xend, int Yend, int Radius, UWORD Color)
+{
+    Canvas_FillRect(&Stamped, Xstart + Radius, Ystart, Xend - Radius, Yend, Color);
+    Canvas_FillRect(&Stamped, Xstart, Ystart + Radius, Xend, Yend - Radius, Color);
+    Stamped_DrawCircle(Xstart + Radius + 1, Ystart + Radius + 1, Radius, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Stamped_DrawCircle(Xend - Radius, Ystart + Radius + 1, Radius, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Stamped_DrawCircle(Xstart + Radius + 1, Yend - Radius, Radius, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Stamped_DrawCircle(Xend - Radius, Yend - Radius, Radius, Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+}
+
+/******************************************************************************
+function: Paint_DrawRoundRect as the filled shape minus the inset one
+info:
+    Background must be the color the canvas was cleared with.
+******************************************************************************/
+static void Stamped_DrawRoundRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius,
+                                  UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill, UWORD Background)
+{
+    if (Xstart >= Xend || Ystart >= Yend)
+        return;
+    int W = Xend - Xstart, H = Yend - Ystart;
+    int R = Radius;
+    if (R > (W - 1) / 2) R = (W - 1) / 2;
+    if (R > (H - 1) / 2) R = (H - 1) / 2;
+    int T = Line_width;
+
+    Stamped_FillRoundRect(Xstart, Ystart, Xend, Yend, R, Color);
+    if (Draw_Fill == DRAW_FILL_EMPTY && 2 * T < W && 2 * T < H)
+        Stamped_FillRoundRect(Xstart + T, Ystart + T, Xend - T, Yend - T, R > T ? R - T : 0, Background);
+}
+
+int main(int argc, char **argv)
+{
+    const UWORD Rotations[] = {ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270};
+    const UBYTE Scales[] = {2, 4, 7};
+    long Shapes = 0, Failed = 0;
+
+    if (argc > 1)
+        Seed = atoi(argv[1]);
+
+    for (UBYTE Scale : Scales)
+        for (UWORD Rotate : Rotations)
+            for (UBYTE Mirror = MIRROR_NONE; Mirror <= MIRROR_ORIGIN; Mirror++) {
+                UWORD Width = (60 + Random(40)) | 1, Height = 40 + Random(30);
+                UWORD Background = Scale == 2 ? WHITE : 1;
+                Paint_NewImage(Image, Width, Height, Rotate, WHITE);
+                Paint_SetScale(Scale);
+                Paint_SetMirroring(Mirror);
+                Canvas_NewImage(&Stamped, Reference, Width + 2 * PAD, Height + 2 * PAD, Rotate, WHITE);
+                Canvas_SetScale(&Stamped, Scale);
+                Canvas_SetMirroring(&Stamped, Mirror);
+
+                for (int i = 0; i < SHAPES; i++) {
+                    bool Round = Random(2);
+                    UWORD X0 = Random(Paint.Width + 1), Y0 = Random(Paint.Height + 1);
+                    UWORD X1 = Random(Paint.Width + 1), Y1 = Random(Paint.Height + 1);
+                    if (Random(3) == 0) X0 = Random(6);
+                    if (Random(3) == 0) Y0 = Random(8);
+                    int Size = Random(3);
+                    UWORD Radius = Size == 0 ? Random(8) : Size == 1 ? Random(60) : Random(MAX_RADIUS);
+                    UWORD Color = Scale == 2 ? BLACK : Random(Scale == 4 ? 4 : 7);
+                    DOT_PIXEL Line_width = (DOT_PIXEL)(1 + Random(8));
+                    DRAW_FILL Draw_Fill = (DRAW_FILL)Random(2);
+                    UWORD Xmin = X0 < X1 ? X0 : X1, Xmax = X0 < X1 ? X1 : X0;
+                    UWORD Ymin = Y0 < Y1 ? Y0 : Y1, Ymax = Y0 < Y1 ? Y1 : Y0;
+
+                    Canvas_Clear(&Stamped, Background);
+                    if (Round)
+                        Stamped_DrawRoundRect(Xmin + PAD, Ymin + PAD, Xmax + PAD, Ymax + PAD,
+                                              Radius, Color, Line_width, Draw_Fill, Background);
+                    else
+                        Stamped_DrawCircle(X0 + PAD, Y0 + PAD, Radius, Color, Line_width, Draw_Fill);
+
+                    Paint_Clear(Background);
+                    if (Round)
+                        Paint_DrawRoundRect(Xmin, Ymin, Xmax, Ymax, Radius, Color, Line_width, Draw_Fill);
+                    else
+                        Paint_DrawCircle(X0, Y0, Radius, Color, Line_width, Draw_Fill);
+
+                    Shapes++;
+                    if (!Same_Pixels()) {
+                        Failed++;
+                        printf("DIFFERENT scale %d rotate %d mirror %d: %s %d %d %d %d radius %d color %d width %d %s\n",
+                               Scale, Rotate, Mirror, Round ? "round rect" : "circle", X0, Y0, X1, Y1,
+                               Radius, Color, Line_width, Draw_Fill == DRAW_FILL_FULL ? "filled" : "empty");
+                    }
+                }
+            }
+
+    printf("%ld shapes, %ld different\n", Shapes, Failed);
+    return Failed ? 1 : 0;
+}
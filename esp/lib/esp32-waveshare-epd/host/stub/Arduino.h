@@ -0,0 +1,36 @@
+/*****************************************************************************
+* | File      	:   Arduino.h
+* | Function    :   Host stand-in for the Arduino core
+* | Info        :
+*   Just enough for DEV_Config.h and the GUI code to build on a PC, the
+*   pin and timing calls do nothing
+*----------------
+******************************************************************************/
+#ifndef __HOST_ARDUINO_H
+#define __HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define INPUT 0
+#define OUTPUT 1
+#define LOW 0
+#define HIGH 1
+
+void pinMode(int Pin, int Mode);
+void digitalWrite(int Pin, int Value);
+int digitalRead(int Pin);
+void delay(unsigned long Ms);
+unsigned long millis(void);
+
+struct HostSerial {
+    void begin(int) {}
+    template<class T> void print(T) {}
+    template<class T> void println(T) {}
+};
+extern HostSerial Serial;
+
+#endif
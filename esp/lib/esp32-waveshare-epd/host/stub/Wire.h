@@ -0,0 +1,2 @@
+/* Host stand-in, utility/Debug.h only needs the Arduino core */
+#include <Arduino.h>
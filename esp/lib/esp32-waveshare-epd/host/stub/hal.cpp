@@ -0,0 +1,16 @@
+/*****************************************************************************
+* | File      	:   hal.cpp
+* | Function    :   Host stand-in for the Arduino core
+* | Info        :
+*   Pins and timing do nothing, enough for the GUI code
+*----------------
+******************************************************************************/
+#include <Arduino.h>
+
+HostSerial Serial;
+
+void pinMode(int, int) {}
+void digitalWrite(int, int) {}
+int digitalRead(int) { return 1; }
+void delay(unsigned long) {}
+unsigned long millis(void) { return 0; }
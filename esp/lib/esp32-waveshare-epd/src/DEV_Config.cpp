@@ -116,8 +116,44 @@ UBYTE DEV_SPI_ReadByte()
     return j;
 }
 
+/******************************************************************************
+function:
+			Write a buffer in one transfer, CS stays low for the whole buffer
+			and MOSI is only written when the next bit differs from the last
+******************************************************************************/
 void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len)
 {
-    for (int i = 0; i < len; i++)
-        DEV_SPI_WriteByte(pData[i]);
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
+
+    int mosi = -1;
+    for (UDOUBLE i = 0; i < len; i++)
+    {
+        UBYTE data = pData[i];
+        for (int j = 0; j < 8; j++)
+        {
+            int bit = (data & 0x80) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+            if (bit != mosi) {
+                digitalWrite(EPD_MOSI_PIN, bit);
+                mosi = bit;
+            }
+
+            data <<= 1;
+            digitalWrite(EPD_SCK_PIN, GPIO_PIN_SET);
+            digitalWrite(EPD_SCK_PIN, GPIO_PIN_RESET);
+        }
+    }
+
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
+}
+
+/******************************************************************************
+function:
+			Busy wait hooks, overridden by the application
+******************************************************************************/
+__attribute__((weak)) void DEV_Busy_Begin(void)
+{
+}
+
+__attribute__((weak)) void DEV_Busy_End(void)
+{
 }
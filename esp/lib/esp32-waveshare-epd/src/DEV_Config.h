@@ -72,4 +72,11 @@ void DEV_SPI_WriteByte(UBYTE data);
 UBYTE DEV_SPI_ReadByte();
 void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len);
 
+/**
+ * Busy wait hooks, weak and empty by default.
+ * The application can override them to e.g. lower the clock while the panel refreshes.
+**/
+void DEV_Busy_Begin(void);
+void DEV_Busy_End(void);
+
 #endif
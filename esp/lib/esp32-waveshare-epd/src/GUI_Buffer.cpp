@@ -0,0 +1,107 @@
+/*****************************************************************************
+* | File      	:   GUI_Buffer.cpp
+* | Function    :   Bulk operations on image buffers
+* | Info        :
+*   Fills and copies with 32-bit aligned stores, pattern expansion for
+*   the 2, 4 and 7 color scales
+*----------------
+******************************************************************************/
+#include "GUI_Buffer.h"
+#include <string.h>
+
+/******************************************************************************
+function: Expand a color to a whole byte of the given scale
+parameter:
+    Scale : 2, 4 or 7 colors
+    Color : Painted colors
+info:
+    Scale 2 keeps the raw color byte, as Paint_Clear always did.
+    Returns 0 for unsupported scales.
+******************************************************************************/
+UBYTE Buffer_Pattern(UBYTE Scale, UWORD Color)
+{
+    switch (Scale) {
+    case 2:
+        return Color;
+    case 4:
+        return (Color << 6) | (Color << 4) | (Color << 2) | Color;
+    case 7:
+    case 16:
+        return (Color << 4) | Color;
+    default:
+        return 0;
+    }
+}
+
+/******************************************************************************
+function: Fill Len bytes with Pattern
+parameter:
+    Dst     : First byte to fill
+    Pattern : Byte value
+    Len     : Number of bytes
+info:
+    Stores bytes until Dst is word aligned, then 32-bit words, unrolled
+    by four, then the remaining bytes.
+******************************************************************************/
+void Buffer_Fill(UBYTE *Dst, UBYTE Pattern, UDOUBLE Len)
+{
+    while (Len > 0 && ((uintptr_t)Dst & 3)) {
+        *Dst++ = Pattern;
+        Len--;
+    }
+
+    UDOUBLE Word = Pattern * 0x01010101UL;
+    UDOUBLE *W = (UDOUBLE *)Dst;
+    UDOUBLE Words = Len / 4;
+    while (Words >= 4) {
+        W[0] = Word;
+        W[1] = Word;
+        W[2] = Word;
+        W[3] = Word;
+        W += 4;
+        Words -= 4;
+    }
+    while (Words > 0) {
+        *W++ = Word;
+        Words--;
+    }
+
+    Dst = (UBYTE *)W;
+    Len %= 4;
+    while (Len > 0) {
+        *Dst++ = Pattern;
+        Len--;
+    }
+}
+
+/******************************************************************************
+function: Copy Len bytes from Src to Dst, the buffers must not overlap
+******************************************************************************/
+void Buffer_Copy(UBYTE *Dst, const UBYTE *Src, UDOUBLE Len)
+{
+    memcpy(Dst, Src, Len);
+}
+
+/******************************************************************************
+function: Invert Len bytes in place, word by word where aligned
+******************************************************************************/
+void Buffer_Invert(UBYTE *Dst, UDOUBLE Len)
+{
+    while (Len > 0 && ((uintptr_t)Dst & 3)) {
+        *Dst = ~*Dst;
+        Dst++;
+        Len--;
+    }
+
+    UDOUBLE *W = (UDOUBLE *)Dst;
+    for (UDOUBLE i = 0; i < Len / 4; i++)
+        W[i] = ~W[i];
+
+    Dst += Len & ~3UL;
+    Len %= 4;
+    while (Len > 0) {
+        *Dst = ~*Dst;
+        Dst++;
+        Len--;
+    }
+}
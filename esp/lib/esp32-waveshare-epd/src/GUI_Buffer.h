@@ -0,0 +1,19 @@
+/*****************************************************************************
+* | File      	:   GUI_Buffer.h
+* | Function    :   Bulk operations on image buffers
+* | Info        :
+*   Fills and copies with 32-bit aligned stores, pattern expansion for
+*   the 2, 4 and 7 color scales
+*----------------
+******************************************************************************/
+#ifndef __GUI_BUFFER_H
+#define __GUI_BUFFER_H
+
+#include "DEV_Config.h"
+
+UBYTE Buffer_Pattern(UBYTE Scale, UWORD Color);
+void Buffer_Fill(UBYTE *Dst, UBYTE Pattern, UDOUBLE Len);
+void Buffer_Copy(UBYTE *Dst, const UBYTE *Src, UDOUBLE Len);
+void Buffer_Invert(UBYTE *Dst, UDOUBLE Len);
+
+#endif
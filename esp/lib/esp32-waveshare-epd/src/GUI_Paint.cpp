@@ -76,6 +76,8 @@
 *
 ******************************************************************************/
 #include "GUI_Paint.h"
+#include "GUI_Buffer.h"
+#include "GUI_Text.h"
 #include "DEV_Config.h"
 #include "utility/Debug.h"
 #include <stdint.h>
@@ -85,6 +87,9 @@
 
 PAINT Paint;
 
+static void Paint_MarkArea(PAINT *Canvas, int Xstart, int Ystart, int Xend, int Yend);
+static void Paint_MarkMemory(PAINT *Canvas, PAINT_RECT Rect);
+
 /******************************************************************************
 function: Create Image
 parameter:
@@ -93,30 +98,38 @@ parameter:
     Height  :   The height of the picture
     Color   :   Whether the picture is inverted
 ******************************************************************************/
-void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+void Canvas_NewImage(PAINT *Canvas, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
 {
-    Paint.Image = NULL;
-    Paint.Image = image;
+    Canvas->Image = NULL;
+    Canvas->Image = image;
 
-    Paint.WidthMemory = Width;
-    Paint.HeightMemory = Height;
-    Paint.Color = Color;    
-    Paint.Scale = 2;
-    Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
-    Paint.HeightByte = Height;    
-//    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
+    Canvas->WidthMemory = Width;
+    Canvas->HeightMemory = Height;
+    Canvas->Color = Color;    
+    Canvas->Scale = 2;
+    Canvas->WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
+    Canvas->HeightByte = Height;    
+//    printf("WidthByte = %d, HeightByte = %d\r\n", Canvas->WidthByte, Canvas->HeightByte);
 //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
-    Paint.Rotate = Rotate;
-    Paint.Mirror = MIRROR_NONE;
+    Canvas->Rotate = Rotate;
+    Canvas->Mirror = MIRROR_NONE;
+    Canvas->DirtyCount = 0;
+    Canvas->DirtyLast = 0;
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
-        Paint.Width = Width;
-        Paint.Height = Height;
+        Canvas->Width = Width;
+        Canvas->Height = Height;
     } else {
-        Paint.Width = Height;
-        Paint.Height = Width;
+        Canvas->Width = Height;
+        Canvas->Height = Width;
     }
+
+    Canvas->Clip.Xstart = 0;
+    Canvas->Clip.Ystart = 0;
+    Canvas->Clip.Xend = Canvas->Width;
+    Canvas->Clip.Yend = Canvas->Height;
+    Canvas->ClipDepth = 0;
 }
 
 /******************************************************************************
@@ -124,9 +137,9 @@ function: Select Image
 parameter:
     image : Pointer to the image cache
 ******************************************************************************/
-void Paint_SelectImage(UBYTE *image)
+void Canvas_SelectImage(PAINT *Canvas, UBYTE *image)
 {
-    Paint.Image = image;
+    Canvas->Image = image;
 }
 
 /******************************************************************************
@@ -134,11 +147,11 @@ function: Select Image Rotate
 parameter:
     Rotate : 0,90,180,270
 ******************************************************************************/
-void Paint_SetRotate(UWORD Rotate)
+void Canvas_SetRotate(PAINT *Canvas, UWORD Rotate)
 {
     if(Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270) {
         // Debug("Set image Rotate %d\r\n", Rotate);
-        Paint.Rotate = Rotate;
+        Canvas->Rotate = Rotate;
     } else {
         Debug("rotate = 0, 90, 180, 270\r\n");
     }
@@ -149,31 +162,31 @@ function:	Select Image mirror
 parameter:
     mirror   :Not mirror,Horizontal mirror,Vertical mirror,Origin mirror
 ******************************************************************************/
-void Paint_SetMirroring(UBYTE mirror)
+void Canvas_SetMirroring(PAINT *Canvas, UBYTE mirror)
 {
     if(mirror == MIRROR_NONE || mirror == MIRROR_HORIZONTAL || 
         mirror == MIRROR_VERTICAL || mirror == MIRROR_ORIGIN) {
         // Debug("mirror image x:%s, y:%s\r\n",(mirror & 0x01)? "mirror":"none", ((mirror >> 1) & 0x01)? "mirror":"none");
-        Paint.Mirror = mirror;
+        Canvas->Mirror = mirror;
     } else {
         Debug("mirror should be MIRROR_NONE, MIRROR_HORIZONTAL, \
         MIRROR_VERTICAL or MIRROR_ORIGIN\r\n");
     }    
 }
 
-void Paint_SetScale(UBYTE scale)
+void Canvas_SetScale(PAINT *Canvas, UBYTE scale)
 {
     if(scale == 2){
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 8 == 0)? (Paint.WidthMemory / 8 ): (Paint.WidthMemory / 8 + 1);
+        Canvas->Scale = scale;
+        Canvas->WidthByte = (Canvas->WidthMemory % 8 == 0)? (Canvas->WidthMemory / 8 ): (Canvas->WidthMemory / 8 + 1);
     }
 	else if(scale == 4) {
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 4 == 0)? (Paint.WidthMemory / 4 ): (Paint.WidthMemory / 4 + 1);
+        Canvas->Scale = scale;
+        Canvas->WidthByte = (Canvas->WidthMemory % 4 == 0)? (Canvas->WidthMemory / 4 ): (Canvas->WidthMemory / 4 + 1);
     }
 	else if(scale == 7) {//Only applicable with 5in65 e-Paper
-		Paint.Scale = 7;
-		Paint.WidthByte = (Paint.WidthMemory % 2 == 0)? (Paint.WidthMemory / 2 ): (Paint.WidthMemory / 2 + 1);
+		Canvas->Scale = 7;
+		Canvas->WidthByte = (Canvas->WidthMemory % 2 == 0)? (Canvas->WidthMemory / 2 ): (Canvas->WidthMemory / 2 + 1);
 	}
 	else {
         Debug("Set Scale Input parameter error\r\n");
@@ -187,604 +200,1870 @@ parameter:
     Ypoint : At point Y
     Color  : Painted colors
 ******************************************************************************/
-void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+void Canvas_SetPixel(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, UWORD Color)
 {
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
+    if(Xpoint < Canvas->Clip.Xstart || Xpoint >= Canvas->Clip.Xend ||
+       Ypoint < Canvas->Clip.Ystart || Ypoint >= Canvas->Clip.Yend){
         Debug("Exceeding display boundaries\r\n");
         return;
     }      
     UWORD X, Y;
-    switch(Paint.Rotate) {
+    switch(Canvas->Rotate) {
     case 0:
         X = Xpoint;
         Y = Ypoint;  
         break;
     case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
+        X = Canvas->WidthMemory - Ypoint - 1;
         Y = Xpoint;
         break;
     case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
+        X = Canvas->WidthMemory - Xpoint - 1;
+        Y = Canvas->HeightMemory - Ypoint - 1;
         break;
     case 270:
         X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
+        Y = Canvas->HeightMemory - Xpoint - 1;
         break;
     default:
         return;
     }
     
-    switch(Paint.Mirror) {
+    switch(Canvas->Mirror) {
     case MIRROR_NONE:
         break;
     case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
+        X = Canvas->WidthMemory - X - 1;
         break;
     case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
+        Y = Canvas->HeightMemory - Y - 1;
         break;
     case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
+        X = Canvas->WidthMemory - X - 1;
+        Y = Canvas->HeightMemory - Y - 1;
         break;
     default:
         return;
     }
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
-        Debug("Exceeding display boundaries\r\n");
-        return;
+    // most pixels land in the rectangle the previous one grew
+    const PAINT_RECT *Last = &Canvas->Dirty[Canvas->DirtyLast];
+    if (Canvas->DirtyLast >= Canvas->DirtyCount ||
+        X < Last->Xstart || X >= Last->Xend || Y < Last->Ystart || Y >= Last->Yend) {
+        PAINT_RECT Rect = {(UWORD)(X & ~7), Y, (UWORD)((X + 8) & ~7), (UWORD)(Y + 1)};
+        Paint_MarkMemory(Canvas, Rect);
     }
-    
-    if(Paint.Scale == 2){
-        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
-        UBYTE Rdata = Paint.Image[Addr];
+
+    if(Canvas->Scale == 2){
+        UDOUBLE Addr = X / 8 + Y * Canvas->WidthByte;
+        UBYTE Rdata = Canvas->Image[Addr];
         if(Color == BLACK)
-            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
+            Canvas->Image[Addr] = Rdata & ~(0x80 >> (X % 8));
         else
-            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-    }else if(Paint.Scale == 4){
-        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
+            Canvas->Image[Addr] = Rdata | (0x80 >> (X % 8));
+    }else if(Canvas->Scale == 4){
+        UDOUBLE Addr = X / 4 + Y * Canvas->WidthByte;
         Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
-        UBYTE Rdata = Paint.Image[Addr];
+        UBYTE Rdata = Canvas->Image[Addr];
         
         Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));
-        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
-    }else if(Paint.Scale == 7 || Paint.Scale == 16){
-		UDOUBLE Addr = X / 2  + Y * Paint.WidthByte;
-		UBYTE Rdata = Paint.Image[Addr];
+        Canvas->Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
+    }else if(Canvas->Scale == 7 || Canvas->Scale == 16){
+		UDOUBLE Addr = X / 2  + Y * Canvas->WidthByte;
+		UBYTE Rdata = Canvas->Image[Addr];
 		Rdata = Rdata & (~(0xF0 >> ((X % 2)*4)));//Clear first, then set value
-		Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
+		Canvas->Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
 		// printf("Add =  %d ,data = %d\r\n",Addr,Rdata);	
     }
 }
 
 /******************************************************************************
-function: Clear the color of the picture
+function: Draw Pixels, specialized for one rotation, mirroring and scale
 parameter:
-    Color : Painted colors
+    Xpoint : At point X
+    Ypoint : At point Y
+    Color  : Painted colors
+info:
+    No bounds check, the caller keeps the point inside the canvas clip.
 ******************************************************************************/
-void Paint_Clear(UWORD Color)
+template<UWORD ROTATE, UBYTE MIRROR, UBYTE SCALE>
+static void Paint_WritePixel(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    const bool SWAP = (ROTATE == ROTATE_90 || ROTATE == ROTATE_270);
+    const bool REV_X = (ROTATE == ROTATE_90 || ROTATE == ROTATE_180) != ((MIRROR & MIRROR_HORIZONTAL) != 0);
+    const bool REV_Y = (ROTATE == ROTATE_180 || ROTATE == ROTATE_270) != ((MIRROR & MIRROR_VERTICAL) != 0);
+
+    // canvas coordinate that ends up on the memory X and Y axis
+    UWORD SrcX = SWAP ? Ypoint : Xpoint;
+    UWORD SrcY = SWAP ? Xpoint : Ypoint;
+    UWORD X = REV_X ? Canvas->WidthMemory - SrcX - 1 : SrcX;
+    UWORD Y = REV_Y ? Canvas->HeightMemory - SrcY - 1 : SrcY;
+
+    if (SCALE == 2) {
+        UDOUBLE Addr = X / 8 + Y * Canvas->WidthByte;
+        if (Color == BLACK)
+            Canvas->Image[Addr] &= ~(0x80 >> (X % 8));
+        else
+            Canvas->Image[Addr] |= (0x80 >> (X % 8));
+    } else if (SCALE == 4) {
+        UDOUBLE Addr = X / 4 + Y * Canvas->WidthByte;
+        UBYTE Shift = (X % 4) * 2;
+        Canvas->Image[Addr] = (Canvas->Image[Addr] & ~(0xC0 >> Shift)) | (((Color % 4) << 6) >> Shift);
+    } else {
+        UDOUBLE Addr = X / 2 + Y * Canvas->WidthByte;
+        UBYTE Shift = (X % 2) * 4;
+        Canvas->Image[Addr] = (Canvas->Image[Addr] & ~(0xF0 >> Shift)) | ((Color << 4) >> Shift);
+    }
+}
+
+static void Paint_WritePixelNone(PAINT *, UWORD, UWORD, UWORD)
 {
-    if(Paint.Scale == 2) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = Color;
-			}
-		}
-    }else if(Paint.Scale == 4) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-                UDOUBLE Addr = X + Y*Paint.WidthByte;
-                Paint.Image[Addr] = (Color<<6)|(Color<<4)|(Color<<2)|Color;
-            }
-        }
-    }else if(Paint.Scale == 7 || Paint.Scale == 16) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = (Color<<4)|Color;
-			}
-		}		
-	}
 }
 
+#define PAINT_WRITERS_SCALE(ROTATE, MIRROR) \
+    { Paint_WritePixel<ROTATE, MIRROR, 2>, Paint_WritePixel<ROTATE, MIRROR, 4>, Paint_WritePixel<ROTATE, MIRROR, 7> }
+#define PAINT_WRITERS_MIRROR(ROTATE) \
+    { PAINT_WRITERS_SCALE(ROTATE, MIRROR_NONE), PAINT_WRITERS_SCALE(ROTATE, MIRROR_HORIZONTAL), \
+      PAINT_WRITERS_SCALE(ROTATE, MIRROR_VERTICAL), PAINT_WRITERS_SCALE(ROTATE, MIRROR_ORIGIN) }
+
+static const PAINT_PIXEL_WRITER Paint_Writers[4][4][3] = {
+    PAINT_WRITERS_MIRROR(ROTATE_0),
+    PAINT_WRITERS_MIRROR(ROTATE_90),
+    PAINT_WRITERS_MIRROR(ROTATE_180),
+    PAINT_WRITERS_MIRROR(ROTATE_270),
+};
+
 /******************************************************************************
-function: Clear the color of a window
-parameter:
-    Xstart : x starting point
-    Ystart : Y starting point
-    Xend   : x end point
-    Yend   : y end point
-    Color  : Painted colors
+function: Select the pixel writer for the current rotation, mirroring and scale
+info:
+    Drawing primitives look this up once per call instead of branching on
+    the PAINT configuration for every pixel.
 ******************************************************************************/
-void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+PAINT_PIXEL_WRITER Canvas_GetPixelWriter(PAINT *Canvas)
 {
-    UWORD X, Y;
-    for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
-        }
+    UBYTE Rotate, Scale;
+    switch (Canvas->Rotate) {
+    case ROTATE_0:   Rotate = 0; break;
+    case ROTATE_90:  Rotate = 1; break;
+    case ROTATE_180: Rotate = 2; break;
+    case ROTATE_270: Rotate = 3; break;
+    default:         return Paint_WritePixelNone;
+    }
+    switch (Canvas->Scale) {
+    case 2:  Scale = 0; break;
+    case 4:  Scale = 1; break;
+    case 7:
+    case 16: Scale = 2; break;
+    default: return Paint_WritePixelNone;
     }
+    if (Canvas->Mirror > MIRROR_ORIGIN)
+        return Paint_WritePixelNone;
+    return Paint_Writers[Rotate][Canvas->Mirror][Scale];
 }
 
 /******************************************************************************
-function: Draw Point(Xpoint, Ypoint) Fill the color
+function: Bits per pixel and the byte filled with Color for the current scale
 parameter:
-    Xpoint		: The Xpoint coordinate of the point
-    Ypoint		: The Ypoint coordinate of the point
-    Color		: Painted color
-    Dot_Pixel	: point size
-    Dot_Style	: point Style
+    Color   : Painted colors
+    Pattern : Receives Color repeated over a whole byte
 ******************************************************************************/
-void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
-                     DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+static UBYTE Paint_ScalePattern(PAINT *Canvas, UWORD Color, UBYTE *Pattern)
 {
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
-        return;
-    }
-
-    int16_t XDir_Num , YDir_Num;
-    if (Dot_Style == DOT_FILL_AROUND) {
-        for (XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
-                if(Xpoint + XDir_Num - Dot_Pixel < 0 || Ypoint + YDir_Num - Dot_Pixel < 0)
-                    break;
-                // printf("x = %d, y = %d\r\n", Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel);
-                Paint_SetPixel(Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
-            }
-        }
-    } else {
-        for (XDir_Num = 0; XDir_Num <  Dot_Pixel; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num <  Dot_Pixel; YDir_Num++) {
-                Paint_SetPixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
-            }
-        }
+    switch (Canvas->Scale) {
+    case 2:
+        *Pattern = (Color == BLACK) ? 0x00 : 0xFF;
+        return 1;
+    case 4:
+        *Pattern = (Color % 4) * 0x55;
+        return 2;
+    case 7:
+    case 16:
+        *Pattern = ((Color & 0x0F) << 4) | (Color & 0x0F);
+        return 4;
+    default:
+        return 0;
     }
 }
 
 /******************************************************************************
-function: Draw a line of arbitrary slope
+function: Fill a rectangle of the image memory
 parameter:
-    Xstart ：Starting Xpoint point coordinates
-    Ystart ：Starting Xpoint point coordinates
-    Xend   ：End point Xpoint coordinate
-    Yend   ：End point Ypoint coordinate
-    Color  ：The color of the line segment
-    Line_width : Line width
-    Line_Style: Solid and dotted lines
+    Xstart : First memory column
+    Ystart : First memory row
+    Xend   : Memory column after the last one
+    Yend   : Memory row after the last one
+    Color  : Painted colors
+info:
+    Whole bytes are set with memset, the partial bytes at both ends of a
+    row are merged with a mask. Coordinates must already be inside memory.
 ******************************************************************************/
-void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
-                    UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+static void Paint_FillMemory(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
-        Debug("Paint_DrawLine Input exceeds the normal display range\r\n");
+    UBYTE Pattern;
+    UBYTE Bpp = Paint_ScalePattern(Canvas, Color, &Pattern);
+    if (Bpp == 0 || Xstart >= Xend || Ystart >= Yend)
         return;
-    }
-
-    UWORD Xpoint = Xstart;
-    UWORD Ypoint = Ystart;
-    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
-    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
-
-    // Increment direction, 1 is positive, -1 is counter;
-    int XAddway = Xstart < Xend ? 1 : -1;
-    int YAddway = Ystart < Yend ? 1 : -1;
 
-    //Cumulative error
-    int Esp = dx + dy;
-    char Dotted_Len = 0;
+    UBYTE Ppb = 8 / Bpp;
+    UWORD First = Xstart / Ppb;
+    UWORD Last = (Xend - 1) / Ppb;
+    UBYTE HeadMask = 0xFF >> ((Xstart % Ppb) * Bpp);
+    UBYTE TailMask = 0xFF << ((Ppb - 1 - (Xend - 1) % Ppb) * Bpp);
 
-    for (;;) {
-        Dotted_Len++;
-        //Painted dotted line, 2 point is really virtual
-        if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
-            //Debug("LINE_DOTTED\r\n");
-            Paint_DrawPoint(Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
-            Dotted_Len = 0;
-        } else {
-            Paint_DrawPoint(Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
+    for (UWORD Y = Ystart; Y < Yend; Y++) {
+        UBYTE *Row = Canvas->Image + (UDOUBLE)Y * Canvas->WidthByte;
+        if (First == Last) {
+            UBYTE Mask = HeadMask & TailMask;
+            Row[First] = (Row[First] & ~Mask) | (Pattern & Mask);
+            continue;
         }
-        if (2 * Esp >= dy) {
-            if (Xpoint == Xend)
-                break;
-            Esp += dy;
-            Xpoint += XAddway;
+        UWORD Start = First;
+        UWORD End = Last + 1;
+        if (HeadMask != 0xFF) {
+            Row[First] = (Row[First] & ~HeadMask) | (Pattern & HeadMask);
+            Start++;
         }
-        if (2 * Esp <= dx) {
-            if (Ypoint == Yend)
-                break;
-            Esp += dx;
-            Ypoint += YAddway;
+        if (TailMask != 0xFF) {
+            Row[Last] = (Row[Last] & ~TailMask) | (Pattern & TailMask);
+            End--;
         }
+        if (End > Start)
+            Buffer_Fill(Row + Start, Pattern, End - Start);
     }
 }
 
 /******************************************************************************
-function: Draw a rectangle
+function: Intersect a canvas rectangle with the clip rectangle
 parameter:
-    Xstart ：Rectangular  Starting Xpoint point coordinates
-    Ystart ：Rectangular  Starting Xpoint point coordinates
-    Xend   ：Rectangular  End point Xpoint coordinate
-    Yend   ：Rectangular  End point Ypoint coordinate
-    Color  ：The color of the Rectangular segment
-    Line_width: Line width
-    Draw_Fill : Whether to fill the inside of the rectangle
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, not included
+    Yend   : y end point, not included
+info:
+    Returns false when nothing is left.
 ******************************************************************************/
-void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
-                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+static bool Paint_ClipArea(const PAINT *Canvas, int *Xstart, int *Ystart, int *Xend, int *Yend)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
-        Debug("Input exceeds the normal display range\r\n");
-        return;
-    }
-
-    if (Draw_Fill) {
-        UWORD Ypoint;
-        for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , Line_width, LINE_STYLE_SOLID);
-        }
-    } else {
-        Paint_DrawLine(Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
-    }
+    if (*Xstart < Canvas->Clip.Xstart) *Xstart = Canvas->Clip.Xstart;
+    if (*Ystart < Canvas->Clip.Ystart) *Ystart = Canvas->Clip.Ystart;
+    if (*Xend > Canvas->Clip.Xend) *Xend = Canvas->Clip.Xend;
+    if (*Yend > Canvas->Clip.Yend) *Yend = Canvas->Clip.Yend;
+    return *Xstart < *Xend && *Ystart < *Yend;
 }
 
 /******************************************************************************
-function: Use the 8-point method to draw a circle of the
-            specified size at the specified position->
+function: Map a rectangle from canvas to memory coordinates
 parameter:
-    X_Center  ：Center X coordinate
-    Y_Center  ：Center Y coordinate
-    Radius    ：circle Radius
-    Color     ：The color of the ：circle segment
-    Line_width: Line width
-    Draw_Fill : Whether to fill the inside of the Circle
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, not included
+    Yend   : y end point, not included
+    X0..Y1 : Receive the memory rectangle, ends not included
+info:
+    The rectangle is clipped and mapped through rotation and mirroring, a
+    rectangle stays a rectangle in memory. Returns false when nothing is
+    left.
 ******************************************************************************/
-void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
-                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+static bool Paint_MapArea(PAINT *Canvas, int Xstart, int Ystart, int Xend, int Yend, int *X0, int *Y0, int *X1, int *Y1)
 {
-    if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
-        Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
-        return;
-    }
+    if (!Paint_ClipArea(Canvas, &Xstart, &Ystart, &Xend, &Yend))
+        return false;
 
-    //Draw a circle from(0, R) as a starting point
-    int16_t XCurrent, YCurrent;
-    XCurrent = 0;
-    YCurrent = Radius;
+    bool Swap, RevX, RevY;
+    switch (Canvas->Rotate) {
+    case ROTATE_0:   Swap = false; RevX = false; RevY = false; break;
+    case ROTATE_90:  Swap = true;  RevX = true;  RevY = false; break;
+    case ROTATE_180: Swap = false; RevX = true;  RevY = true;  break;
+    case ROTATE_270: Swap = true;  RevX = false; RevY = true;  break;
+    default: return false;
+    }
+    if (Canvas->Mirror & MIRROR_HORIZONTAL) RevX = !RevX;
+    if (Canvas->Mirror & MIRROR_VERTICAL) RevY = !RevY;
 
-    //Cumulative error,judge the next point of the logo
-    int16_t Esp = 3 - (Radius << 1 );
+    *X0 = Swap ? Ystart : Xstart;
+    *X1 = Swap ? Yend : Xend;
+    *Y0 = Swap ? Xstart : Ystart;
+    *Y1 = Swap ? Xend : Yend;
+    if (*X1 > Canvas->WidthMemory) *X1 = Canvas->WidthMemory;
+    if (*Y1 > Canvas->HeightMemory) *Y1 = Canvas->HeightMemory;
+    if (*X0 >= *X1 || *Y0 >= *Y1)
+        return false;
 
-    int16_t sCountY;
-    if (Draw_Fill == DRAW_FILL_FULL) {
-        while (XCurrent <= YCurrent ) { //Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY ++ ) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
-            if (Esp < 0 )
-                Esp += 4 * XCurrent + 6;
-            else {
-                Esp += 10 + 4 * (XCurrent - YCurrent );
-                YCurrent --;
-            }
-            XCurrent ++;
-        }
-    } else { //Draw a hollow circle
-        while (XCurrent <= YCurrent ) {
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
-
-            if (Esp < 0 )
-                Esp += 4 * XCurrent + 6;
-            else {
-                Esp += 10 + 4 * (XCurrent - YCurrent );
-                YCurrent --;
-            }
-            XCurrent ++;
-        }
+    if (RevX) {
+        int T = Canvas->WidthMemory - *X1;
+        *X1 = Canvas->WidthMemory - *X0;
+        *X0 = T;
     }
+    if (RevY) {
+        int T = Canvas->HeightMemory - *Y1;
+        *Y1 = Canvas->HeightMemory - *Y0;
+        *Y0 = T;
+    }
+    return true;
 }
 
 /******************************************************************************
-function: Show English characters
+function: Fill a rectangle given in canvas coordinates
 parameter:
-    Xpoint           ：X coordinate
-    Ypoint           ：Y coordinate
-    Acsii_Char       ：To display the English characters
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, not filled
+    Yend   : y end point, not filled
+    Color  : Painted colors
 ******************************************************************************/
-void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
-                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+static void Paint_FillArea(PAINT *Canvas, int Xstart, int Ystart, int Xend, int Yend, UWORD Color)
 {
-    UWORD Page, Column;
-
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
-        return;
-    }
-
-    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-    const unsigned char *ptr = &Font->table[Char_Offset];
-
-    for (Page = 0; Page < Font->Height; Page ++ ) {
-        for (Column = 0; Column < Font->Width; Column ++ ) {
-
-            //To determine whether the font background color and screen background color is consistent
-            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                if (*ptr & (0x80 >> (Column % 8)))
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            } else {
-                if (*ptr & (0x80 >> (Column % 8))) {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                } else {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                }
-            }
-            //One pixel is 8 bits
-            if (Column % 8 == 7)
-                ptr++;
-        }// Write a line
-        if (Font->Width % 8 != 0)
-            ptr++;
-    }// Write all
+    int X0, Y0, X1, Y1;
+    if (Paint_MapArea(Canvas, Xstart, Ystart, Xend, Yend, &X0, &Y0, &X1, &Y1))
+        Paint_FillMemory(Canvas, X0, Y0, X1, Y1, Color);
 }
 
 /******************************************************************************
-function:	Display the string
+function: Add a memory rectangle to the dirty list
 parameter:
-    Xstart           ：X coordinate
-    Ystart           ：Y coordinate
-    pString          ：The first address of the English string to be displayed
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Rect : Rectangle, X already aligned to whole bytes
+info:
+    Rectangles whose union costs no more area than both of them are merged
+    right away. Past PAINT_DIRTY_MAX, the pair whose union adds the least
+    area is merged.
 ******************************************************************************/
-void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
-                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+static UDOUBLE Paint_RectArea(const PAINT_RECT *Rect)
 {
-    UWORD Xpoint = Xstart;
-    UWORD Ypoint = Ystart;
+    return (UDOUBLE)(Rect->Xend - Rect->Xstart) * (Rect->Yend - Rect->Ystart);
+}
 
-    if (Xstart > Paint.Width || Ystart > Paint.Height) {
-        Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
-        return;
-    }
+static PAINT_RECT Paint_RectUnion(const PAINT_RECT *A, const PAINT_RECT *B)
+{
+    PAINT_RECT U;
+    U.Xstart = A->Xstart < B->Xstart ? A->Xstart : B->Xstart;
+    U.Ystart = A->Ystart < B->Ystart ? A->Ystart : B->Ystart;
+    U.Xend = A->Xend > B->Xend ? A->Xend : B->Xend;
+    U.Yend = A->Yend > B->Yend ? A->Yend : B->Yend;
+    return U;
+}
 
-    while (* pString != '\0') {
-        //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
-        if ((Xpoint + Font->Width ) > Paint.Width ) {
-            Xpoint = Xstart;
-            Ypoint += Font->Height;
+static void Paint_AddDirty(PAINT *Canvas, PAINT_RECT Rect)
+{
+    // a grown rectangle may now swallow one that was checked before
+    bool Grown = true;
+    while (Grown) {
+        Grown = false;
+        for (UBYTE i = 0; i < Canvas->DirtyCount; i++) {
+            PAINT_RECT U = Paint_RectUnion(&Rect, &Canvas->Dirty[i]);
+            if (Paint_RectArea(&U) <= Paint_RectArea(&Rect) + Paint_RectArea(&Canvas->Dirty[i])) {
+                Rect = U;
+                Canvas->Dirty[i] = Canvas->Dirty[--Canvas->DirtyCount];
+                Grown = true;
+                break;
+            }
         }
+    }
+    if (Canvas->DirtyCount < PAINT_DIRTY_MAX) {
+        Canvas->Dirty[Canvas->DirtyCount++] = Rect;
+        return;
+    }
 
-        // If the Y direction is full, reposition to(Xstart, Ystart)
-        if ((Ypoint  + Font->Height ) > Paint.Height ) {
-            Xpoint = Xstart;
-            Ypoint = Ystart;
+    // over budget: Rect sits in slot PAINT_DIRTY_MAX of the candidates
+    PAINT_RECT All[PAINT_DIRTY_MAX + 1];
+    memcpy(All, Canvas->Dirty, sizeof(Canvas->Dirty));
+    All[PAINT_DIRTY_MAX] = Rect;
+    UBYTE BestA = 0, BestB = 1;
+    int32_t BestCost = INT32_MAX;
+    for (UBYTE a = 0; a < PAINT_DIRTY_MAX; a++) {
+        for (UBYTE b = a + 1; b <= PAINT_DIRTY_MAX; b++) {
+            PAINT_RECT U = Paint_RectUnion(&All[a], &All[b]);
+            int32_t Cost = (int32_t)Paint_RectArea(&U) - (int32_t)Paint_RectArea(&All[a]) - (int32_t)Paint_RectArea(&All[b]);
+            if (Cost < BestCost) {
+                BestCost = Cost;
+                BestA = a;
+                BestB = b;
+            }
         }
-        Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
-
-        //The next character of the address
-        pString ++;
-
-        //The next word of the abscissa increases the font of the broadband
-        Xpoint += Font->Width;
     }
+    PAINT_RECT Merged = Paint_RectUnion(&All[BestA], &All[BestB]);
+    All[BestB] = All[PAINT_DIRTY_MAX];
+    Canvas->DirtyCount = 0;
+    for (UBYTE i = 0; i < PAINT_DIRTY_MAX; i++) {
+        if (i != BestA)
+            Canvas->Dirty[Canvas->DirtyCount++] = All[i];
+    }
+    Paint_AddDirty(Canvas, Merged);
 }
 
-
 /******************************************************************************
-function: Display the string
+function: Add a memory rectangle to the dirty list unless it is covered
 parameter:
-    Xstart  ：X coordinate
-    Ystart  ：Y coordinate
-    pString ：The first address of the Chinese string and English
-              string to be displayed
-    Font    ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Rect : Rectangle, X already aligned to whole bytes
+info:
+    The rectangle touched last is tried first, then the others, before
+    the merge in Paint_AddDirty. DirtyLast is only a hint.
 ******************************************************************************/
-void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
-                        UWORD Color_Foreground, UWORD Color_Background)
+static void Paint_MarkMemory(PAINT *Canvas, PAINT_RECT Rect)
 {
-    const char* p_text = pString;
-    int x = Xstart, y = Ystart;
-    int i, j,Num;
-
-    /* Send the string character by character on EPD */
-    while (*p_text != 0) {
-        if(*p_text <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
-            /* Point on the next character */
-            p_text += 1;
-            /* Decrement the column position by 16 */
-            x += font->ASCII_Width;
-        } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if ((*p_text == font->table[Num].index[0]) && \
-                    (*(p_text + 1) == font->table[Num].index[1]) && \
-                    (*(p_text + 2) == font->table[Num].index[2])) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
-            /* Point on the next character */
-            p_text += 3;
-            /* Decrement the column position by 16 */
-            x += font->Width;
+    for (UBYTE n = 0; n <= Canvas->DirtyCount; n++) {
+        UBYTE i = n == 0 ? Canvas->DirtyLast : n - 1;
+        if (i >= Canvas->DirtyCount)
+            continue;
+        const PAINT_RECT *D = &Canvas->Dirty[i];
+        if (Rect.Xstart >= D->Xstart && Rect.Xend <= D->Xend &&
+            Rect.Ystart >= D->Ystart && Rect.Yend <= D->Yend) {
+            Canvas->DirtyLast = i;
+            return;
         }
     }
+    Paint_AddDirty(Canvas, Rect);
+    Canvas->DirtyLast = Canvas->DirtyCount - 1;
 }
 
 /******************************************************************************
-function:	Display nummber
+function: Mark a canvas rectangle as changed
 parameter:
-    Xstart           ：X coordinate
-    Ystart           : Y coordinate
-    Nummber          : The number displayed
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, not included
+    Yend   : y end point, not included
+info:
+    The rectangle is clipped, mapped to memory and widened to whole bytes.
 ******************************************************************************/
-#define  ARRAY_LEN 255
-void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
-                   sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+static void Paint_MarkArea(PAINT *Canvas, int Xstart, int Ystart, int Xend, int Yend)
 {
-
-    int16_t Num_Bit = 0, Str_Bit = 0;
-    uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
-    uint8_t *pStr = Str_Array;
-
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DisNum Input exceeds the normal display range\r\n");
+    int X0, Y0, X1, Y1;
+    if (!Paint_MapArea(Canvas, Xstart, Ystart, Xend, Yend, &X0, &Y0, &X1, &Y1))
         return;
-    }
-
-    //Converts a number to a string
-    while (Nummber) {
-        Num_Array[Num_Bit] = Nummber % 10 + '0';
-        Num_Bit++;
-        Nummber /= 10;
-    }
 
-    //The string is inverted
-    while (Num_Bit > 0) {
-        Str_Array[Str_Bit] = Num_Array[Num_Bit - 1];
-        Str_Bit ++;
-        Num_Bit --;
-    }
+    PAINT_RECT Rect;
+    Rect.Xstart = X0 & ~7;
+    Rect.Xend = (X1 + 7) & ~7;
+    Rect.Ystart = Y0;
+    Rect.Yend = Y1;
+    Paint_MarkMemory(Canvas, Rect);
+}
 
-    //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
+void Canvas_MarkDirty(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    Paint_MarkArea(Canvas, Xstart, Ystart, Xend, Yend);
 }
 
 /******************************************************************************
-function:	Display time
-parameter:
-    Xstart           ：X coordinate
-    Ystart           : Y coordinate
-    pTime            : Time-related structures
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+function: Forget the changed regions, e.g. after they were refreshed
 ******************************************************************************/
-void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
-                    UWORD Color_Foreground, UWORD Color_Background)
+void Canvas_ResetDirty(PAINT *Canvas)
 {
-    uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
-
-    UWORD Dx = Font->Width;
-
-    //Write data into the cache
-    Paint_DrawChar(Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
+    Canvas->DirtyCount = 0;
+    Canvas->DirtyLast = 0;
 }
 
 /******************************************************************************
-function:	Display monochrome bitmap
+function: Restrict drawing to a rectangle until the matching Canvas_PopClip
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, not included
+    Yend   : y end point, not included
+info:
+    The new clip is the intersection with the current one and may be empty.
+    Returns false, leaving the clip unchanged, when PAINT_CLIP_DEPTH clips
+    are already pushed.
+******************************************************************************/
+bool Canvas_PushClip(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if (Canvas->ClipDepth >= PAINT_CLIP_DEPTH) {
+        Debug("Canvas_PushClip: clip stack is full\r\n");
+        return false;
+    }
+    Canvas->ClipStack[Canvas->ClipDepth++] = Canvas->Clip;
+
+    int X0 = Xstart, Y0 = Ystart, X1 = Xend, Y1 = Yend;
+    if (!Paint_ClipArea(Canvas, &X0, &Y0, &X1, &Y1)) {
+        X1 = X0;
+        Y1 = Y0;
+    }
+    Canvas->Clip.Xstart = X0;
+    Canvas->Clip.Ystart = Y0;
+    Canvas->Clip.Xend = X1;
+    Canvas->Clip.Yend = Y1;
+    return true;
+}
+
+/******************************************************************************
+function: Restore the clip that was current before the last Canvas_PushClip
+******************************************************************************/
+void Canvas_PopClip(PAINT *Canvas)
+{
+    if (Canvas->ClipDepth == 0) {
+        Debug("Canvas_PopClip: clip stack is empty\r\n");
+        return;
+    }
+    Canvas->Clip = Canvas->ClipStack[--Canvas->ClipDepth];
+}
+
+void Canvas_FillRect(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    Paint_MarkArea(Canvas, Xstart, Ystart, Xend, Yend);
+    Paint_FillArea(Canvas, Xstart, Ystart, Xend, Yend, Color);
+}
+
+/******************************************************************************
+function: Fill the area covered by a Paint_DrawPoint square
+parameter:
+    Xstart : X of the first point
+    Ystart : Y of the first point
+    Xend   : X of the last point
+    Yend   : Y of the last point
+    Color  : Painted colors
+    Dot_Pixel : point size
+info:
+    Covers every pixel that drawing a DOT_FILL_AROUND point at each position
+    of the (inclusive) range would.
+******************************************************************************/
+static void Paint_FillDots(PAINT *Canvas, int Xstart, int Ystart, int Xend, int Yend, UWORD Color, DOT_PIXEL Dot_Pixel)
+{
+    if (Xstart > Xend || Ystart > Yend)
+        return;
+    Paint_FillArea(Canvas, Xstart - Dot_Pixel, Ystart - Dot_Pixel, Xend + Dot_Pixel - 1, Yend + Dot_Pixel - 1, Color);
+}
+
+/******************************************************************************
+function: Clear the color of the picture
+parameter:
+    Color : Painted colors
+info:
+    Only the clip rectangle is cleared while a clip is pushed.
+******************************************************************************/
+void Canvas_Clear(PAINT *Canvas, UWORD Color)
+{
+    if (Canvas->Scale != 2 && Canvas->Scale != 4 && Canvas->Scale != 7 && Canvas->Scale != 16)
+        return;
+    const PAINT_RECT *Clip = &Canvas->Clip;
+    Paint_MarkArea(Canvas, Clip->Xstart, Clip->Ystart, Clip->Xend, Clip->Yend);
+    if (Clip->Xstart == 0 && Clip->Ystart == 0 && Clip->Xend == Canvas->Width && Clip->Yend == Canvas->Height)
+        Buffer_Fill(Canvas->Image, Buffer_Pattern(Canvas->Scale, Color), (UDOUBLE)Canvas->WidthByte * Canvas->HeightByte);
+    else
+        Paint_FillArea(Canvas, Clip->Xstart, Clip->Ystart, Clip->Xend, Clip->Yend, Color);
+}
+
+/******************************************************************************
+function: Clear the color of a window
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point
+    Yend   : y end point
+    Color  : Painted colors
+******************************************************************************/
+void Canvas_ClearWindows(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    Paint_MarkArea(Canvas, Xstart, Ystart, Xend, Yend);
+    Paint_FillArea(Canvas, Xstart, Ystart, Xend, Yend, Color);
+}
+
+/******************************************************************************
+function: Draw Point(Xpoint, Ypoint) Fill the color
+parameter:
+    Xpoint		: The Xpoint coordinate of the point
+    Ypoint		: The Ypoint coordinate of the point
+    Color		: Painted color
+    Dot_Pixel	: point size
+    Dot_Style	: point Style
+info:
+    DOT_FILL_AROUND covers [X-w, X+w-2] and DOT_FILL_RIGHTUP [X-1, X+w-2] on
+    both axes. The square is clipped once, then written without checks.
+******************************************************************************/
+static void Paint_DrawPointWith(PAINT *Canvas, PAINT_PIXEL_WRITER SetPixel, int Xpoint, int Ypoint, UWORD Color,
+                                DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    int X0 = Dot_Style == DOT_FILL_AROUND ? Xpoint - Dot_Pixel : Xpoint - 1;
+    int Y0 = Dot_Style == DOT_FILL_AROUND ? Ypoint - Dot_Pixel : Ypoint - 1;
+    int X1 = Xpoint + Dot_Pixel - 1;
+    int Y1 = Ypoint + Dot_Pixel - 1;
+    if (!Paint_ClipArea(Canvas, &X0, &Y0, &X1, &Y1))
+        return;
+
+    for (int X = X0; X < X1; X++)
+        for (int Y = Y0; Y < Y1; Y++)
+            SetPixel(Canvas, X, Y, Color);
+}
+
+void Canvas_DrawPoint(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, UWORD Color,
+                     DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    if (Dot_Style == DOT_FILL_AROUND)
+        Paint_MarkArea(Canvas, Xpoint - Dot_Pixel, Ypoint - Dot_Pixel, Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1);
+    else
+        Paint_MarkArea(Canvas, Xpoint - 1, Ypoint - 1, Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1);
+    Paint_DrawPointWith(Canvas, Canvas_GetPixelWriter(Canvas), Xpoint, Ypoint, Color, Dot_Pixel, Dot_Style);
+}
+
+/******************************************************************************
+function: Bresenham cursor that walks a line one row at a time
+info:
+    Steps exactly like the loop in Paint_DrawLine, from Xstart/Ystart to
+    Xend/Yend. Each Paint_LineNextRow reports the range of X visited at the
+    next Y along the line.
+******************************************************************************/
+typedef struct {
+    int X, Y, Xend, Yend;
+    int Dx, Dy, Esp;
+    int XAddway, YAddway;
+    int RowY, RowXmin, RowXmax;
+    bool Started, Done;
+} PAINT_LINE_CURSOR;
+
+static void Paint_LineBegin(PAINT_LINE_CURSOR *Line, int Xstart, int Ystart, int Xend, int Yend)
+{
+    Line->X = Xstart;
+    Line->Y = Ystart;
+    Line->Xend = Xend;
+    Line->Yend = Yend;
+    Line->Dx = Xend >= Xstart ? Xend - Xstart : Xstart - Xend;
+    Line->Dy = Yend <= Ystart ? Yend - Ystart : Ystart - Yend;
+    Line->Esp = Line->Dx + Line->Dy;
+    Line->XAddway = Xstart < Xend ? 1 : -1;
+    Line->YAddway = Ystart < Yend ? 1 : -1;
+    Line->Started = false;
+    Line->Done = false;
+}
+
+static void Paint_LineNextRow(PAINT_LINE_CURSOR *Line)
+{
+    Line->Started = true;
+    Line->RowY = Line->Y;
+    Line->RowXmin = Line->RowXmax = Line->X;
+    for (;;) {
+        if (2 * Line->Esp >= Line->Dy) {
+            if (Line->X == Line->Xend) {
+                Line->Done = true;
+                return;
+            }
+            Line->Esp += Line->Dy;
+            Line->X += Line->XAddway;
+        }
+        if (2 * Line->Esp <= Line->Dx) {
+            if (Line->Y == Line->Yend) {
+                Line->Done = true;
+                return;
+            }
+            Line->Esp += Line->Dx;
+            Line->Y += Line->YAddway;
+            return;
+        }
+        if (Line->X < Line->RowXmin) Line->RowXmin = Line->X;
+        if (Line->X > Line->RowXmax) Line->RowXmax = Line->X;
+    }
+}
+
+// Advance to row Y, which must lie ahead on the line
+static void Paint_LineSeekRow(PAINT_LINE_CURSOR *Line, int Y)
+{
+    while (!Line->Started || (Line->RowY != Y && !Line->Done))
+        Paint_LineNextRow(Line);
+}
+
+/******************************************************************************
+function: Draw a thick solid line as one span per row
+parameter:
+    Xstart ：Starting Xpoint point coordinates
+    Ystart ：Starting Xpoint point coordinates
+    Xend   ：End point Xpoint coordinate
+    Yend   ：End point Ypoint coordinate
+    Color  ：The color of the line segment
+    Dot_Pixel : Line width
+info:
+    A row R is covered by the points whose Y lies in [R-w+2, R+w]. X is
+    monotonic along the line, so the span is bounded by the points at the
+    two ends of that window, which two cursors track as R advances in the
+    line's Y direction. Same pixels as stamping a point per step. Rows
+    outside of the clip are skipped.
+******************************************************************************/
+static void Paint_DrawLineSpans(PAINT *Canvas, int Xstart, int Ystart, int Xend, int Yend, UWORD Color, DOT_PIXEL Dot_Pixel)
+{
+    int W = Dot_Pixel;
+    int YAddway = Ystart < Yend ? 1 : -1;
+    int First = Ystart, Last = Yend;
+
+    int Row = YAddway > 0 ? First - W : First + W - 2;
+    int RowEnd = YAddway > 0 ? Last + W - 2 : Last - W;
+    int Top = Canvas->Clip.Ystart, Bottom = Canvas->Clip.Yend - 1;
+    if (YAddway > 0) {
+        if (Row < Top) Row = Top;
+        if (RowEnd > Bottom) RowEnd = Bottom;
+    } else {
+        if (Row > Bottom) Row = Bottom;
+        if (RowEnd < Top) RowEnd = Top;
+    }
+    if ((RowEnd - Row) * YAddway < 0)
+        return;
+
+    PAINT_LINE_CURSOR Head, Tail;
+    Paint_LineBegin(&Head, Xstart, Ystart, Xend, Yend);
+    Paint_LineBegin(&Tail, Xstart, Ystart, Xend, Yend);
+
+    for (;; Row += YAddway) {
+        int Lo = YAddway > 0 ? Row - W + 2 : Row + W;
+        int Hi = YAddway > 0 ? Row + W : Row - W + 2;
+        if ((Lo - First) * YAddway < 0) Lo = First;
+        if ((Hi - Last) * YAddway > 0) Hi = Last;
+
+        Paint_LineSeekRow(&Tail, Lo);
+        Paint_LineSeekRow(&Head, Hi);
+        int Xmin = Tail.RowXmin < Head.RowXmin ? Tail.RowXmin : Head.RowXmin;
+        int Xmax = Tail.RowXmax > Head.RowXmax ? Tail.RowXmax : Head.RowXmax;
+        Paint_FillArea(Canvas, Xmin - W, Row, Xmax + W - 1, Row + 1, Color);
+
+        if (Row == RowEnd)
+            break;
+    }
+}
+
+/******************************************************************************
+function: Draw a dotted horizontal or vertical line
+parameter:
+    Xstart ：Starting Xpoint point coordinates
+    Ystart ：Starting Xpoint point coordinates
+    Xend   ：End point Xpoint coordinate
+    Yend   ：End point Ypoint coordinate
+    Color  ：The color of the line segment
+    Dot_Pixel : Line width
+info:
+    Every point overwrites all but one row or column of the previous one, so
+    each step only owns that line and the last step owns its whole square.
+    Owned lines are merged into runs of one color and filled once.
+******************************************************************************/
+static void Paint_DrawDottedAxis(PAINT *Canvas, int Xstart, int Ystart, int Xend, int Yend, UWORD Color, DOT_PIXEL Dot_Pixel)
+{
+    int W = Dot_Pixel;
+    bool Vertical = Ystart != Yend;
+    int From = Vertical ? Ystart : Xstart;
+    int To = Vertical ? Yend : Xend;
+    int Cross = Vertical ? Xstart : Ystart;
+    int Addway = From < To ? 1 : -1;
+    int Steps = (To - From) * Addway;
+
+    UBYTE Dotted_Mask = 0x01;
+    int RunLo = 0, RunHi = -1;
+    UWORD RunColor = Color;
+    for (int i = 0; i <= Steps; i++) {
+        int P = From + i * Addway;
+        UWORD StepColor = (Dotted_Mask & 0x04) ? IMAGE_BACKGROUND : Color;
+        Dotted_Mask = ((Dotted_Mask << 1) | (Dotted_Mask >> 2)) & 0x07;
+
+        int Lo = (i == Steps || Addway > 0) ? P - W : P + W - 2;
+        int Hi = (i == Steps || Addway < 0) ? P + W - 2 : P - W;
+        if (RunHi >= RunLo && StepColor != RunColor) {
+            if (Vertical)
+                Paint_FillArea(Canvas, Cross - W, RunLo, Cross + W - 1, RunHi + 1, RunColor);
+            else
+                Paint_FillArea(Canvas, RunLo, Cross - W, RunHi + 1, Cross + W - 1, RunColor);
+            RunHi = RunLo - 1;
+        }
+        if (RunHi < RunLo) {
+            RunLo = Lo;
+            RunHi = Hi;
+            RunColor = StepColor;
+        } else {
+            if (Lo < RunLo) RunLo = Lo;
+            if (Hi > RunHi) RunHi = Hi;
+        }
+    }
+    if (Vertical)
+        Paint_FillArea(Canvas, Cross - W, RunLo, Cross + W - 1, RunHi + 1, RunColor);
+    else
+        Paint_FillArea(Canvas, RunLo, Cross - W, RunHi + 1, Cross + W - 1, RunColor);
+}
+
+/******************************************************************************
+function: Draw a line of arbitrary slope
+parameter:
+    Xstart ：Starting Xpoint point coordinates
+    Ystart ：Starting Xpoint point coordinates
+    Xend   ：End point Xpoint coordinate
+    Yend   ：End point Ypoint coordinate
+    Color  ：The color of the line segment
+    Line_width : Line width
+    Line_Style: Solid and dotted lines
+info:
+    Solid horizontal and vertical lines are a single fill, thick solid
+    lines one span per row and single pixel lines one pixel per step.
+    Dotted lines repeat the mask foreground, foreground, background.
+    Lines are clipped, the part inside the clip is drawn.
+******************************************************************************/
+void Canvas_DrawLine(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                    UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    int X0 = (Xstart < Xend ? Xstart : Xend) - Line_width;
+    int Y0 = (Ystart < Yend ? Ystart : Yend) - Line_width;
+    int X1 = (Xstart < Xend ? Xend : Xstart) + Line_width - 1;
+    int Y1 = (Ystart < Yend ? Yend : Ystart) + Line_width - 1;
+    if (!Paint_ClipArea(Canvas, &X0, &Y0, &X1, &Y1))
+        return;
+    Paint_MarkArea(Canvas, X0, Y0, X1, Y1);
+
+    bool Axis = (Xstart == Xend || Ystart == Yend);
+    if (Axis && Line_Style == LINE_STYLE_SOLID) {
+        Paint_FillDots(Canvas, Xstart < Xend ? Xstart : Xend, Ystart < Yend ? Ystart : Yend,
+                       Xstart < Xend ? Xend : Xstart, Ystart < Yend ? Yend : Ystart,
+                       Color, Line_width);
+        return;
+    }
+    if (Axis && Line_width > DOT_PIXEL_1X1) {
+        Paint_DrawDottedAxis(Canvas, Xstart, Ystart, Xend, Yend, Color, Line_width);
+        return;
+    }
+    if (Line_width > DOT_PIXEL_1X1 && Line_Style == LINE_STYLE_SOLID) {
+        Paint_DrawLineSpans(Canvas, Xstart, Ystart, Xend, Yend, Color, Line_width);
+        return;
+    }
+
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+
+    // Increment direction, 1 is positive, -1 is counter;
+    int XAddway = Xstart < Xend ? 1 : -1;
+    int YAddway = Ystart < Yend ? 1 : -1;
+
+    //Cumulative error
+    int Esp = dx + dy;
+    UBYTE Dotted_Mask = 0x01;
+    PAINT_PIXEL_WRITER SetPixel = Canvas_GetPixelWriter(Canvas);
+    const PAINT_RECT *Clip = &Canvas->Clip;
+    bool Entered = false;
+
+    for (;;) {
+        //Painted dotted line, 2 point is really virtual
+        UWORD StepColor = Color;
+        if (Line_Style == LINE_STYLE_DOTTED && (Dotted_Mask & 0x04))
+            StepColor = IMAGE_BACKGROUND;
+        Dotted_Mask = ((Dotted_Mask << 1) | (Dotted_Mask >> 2)) & 0x07;
+
+        if (Line_width == DOT_PIXEL_1X1) {
+            // a 1x1 point lands up and left of its position. Both coordinates
+            // are monotonic, so once the line has left the clip it is done
+            int X = Xpoint - 1, Y = Ypoint - 1;
+            if (X >= Clip->Xstart && X < Clip->Xend && Y >= Clip->Ystart && Y < Clip->Yend) {
+                SetPixel(Canvas, X, Y, StepColor);
+                Entered = true;
+            } else if (Entered) {
+                break;
+            }
+        } else {
+            // thick dotted steps overwrite each other, keep the stamping order
+            Paint_DrawPointWith(Canvas, SetPixel, Xpoint, Ypoint, StepColor, Line_width, DOT_STYLE_DFT);
+        }
+        if (2 * Esp >= dy) {
+            if (Xpoint == Xend)
+                break;
+            Esp += dy;
+            Xpoint += XAddway;
+        }
+        if (2 * Esp <= dx) {
+            if (Ypoint == Yend)
+                break;
+            Esp += dx;
+            Ypoint += YAddway;
+        }
+    }
+}
+
+/******************************************************************************
+function: Draw a rectangle
+parameter:
+    Xstart ：Rectangular  Starting Xpoint point coordinates
+    Ystart ：Rectangular  Starting Xpoint point coordinates
+    Xend   ：Rectangular  End point Xpoint coordinate
+    Yend   ：Rectangular  End point Ypoint coordinate
+    Color  ：The color of the Rectangular segment
+    Line_width: Line width
+    Draw_Fill : Whether to fill the inside of the rectangle
+******************************************************************************/
+void Canvas_DrawRectangle(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    int Xmin = Xstart < Xend ? Xstart : Xend;
+    int Xmax = Xstart < Xend ? Xend : Xstart;
+    int Ymin = Ystart < Yend ? Ystart : Yend;
+    int Ymax = Ystart < Yend ? Yend : Ystart;
+    Paint_MarkArea(Canvas, Xmin - Line_width, Ymin - Line_width, Xmax + Line_width - 1, Ymax + Line_width - 1);
+
+    // same coverage as the per row / per edge lines, one span fill each
+    if (Draw_Fill) {
+        Paint_FillDots(Canvas, Xmin, Ystart, Xmax, (int)Yend - 1, Color, Line_width);
+    } else {
+        Paint_FillDots(Canvas, Xmin, Ystart, Xmax, Ystart, Color, Line_width);
+        Paint_FillDots(Canvas, Xstart, Ymin, Xstart, Ymax, Color, Line_width);
+        Paint_FillDots(Canvas, Xend, Ymin, Xend, Ymax, Color, Line_width);
+        Paint_FillDots(Canvas, Xmin, Yend, Xmax, Yend, Color, Line_width);
+    }
+}
+
+/******************************************************************************
+function: Half widths of a midpoint disc, row by row
+parameter:
+    Radius : disc radius
+    Half   : Receives the half width of rows 0..Radius from the center
+info:
+    Same stepping as Paint_DrawCircle. Row XCurrent spans YCurrent, row
+    YCurrent spans the last XCurrent seen before YCurrent steps down.
+******************************************************************************/
+static void Paint_DiscHalfWidths(UWORD Radius, UWORD *Half)
+{
+    int16_t XCurrent = 0, YCurrent = Radius;
+    int16_t Esp = 3 - (Radius << 1);
+    while (XCurrent <= YCurrent) {
+        Half[XCurrent] = YCurrent;
+        if (Esp < 0)
+            Esp += 4 * XCurrent + 6;
+        else {
+            if (XCurrent != YCurrent)
+                Half[YCurrent] = XCurrent;
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+}
+
+/******************************************************************************
+function: Fill the disc Paint_DrawCircle covers, one span per row
+parameter:
+    X_Center  ：Center X coordinate
+    Y_Center  ：Center Y coordinate
+    Radius    ：circle Radius
+    Color     ：The color of the circle
+info:
+    The 1x1 points of the original fill land up and left of their position,
+    hence the -1 on both axes.
+******************************************************************************/
+static void Paint_FillDisc(PAINT *Canvas, int X_Center, int Y_Center, UWORD Radius, UWORD Color)
+{
+    int16_t XCurrent = 0, YCurrent = Radius;
+    int16_t Esp = 3 - (Radius << 1);
+    int X = X_Center - 1, Y = Y_Center - 1;
+    while (XCurrent <= YCurrent) {
+        Paint_FillArea(Canvas, X - YCurrent, Y + XCurrent, X + YCurrent + 1, Y + XCurrent + 1, Color);
+        if (XCurrent != 0)
+            Paint_FillArea(Canvas, X - YCurrent, Y - XCurrent, X + YCurrent + 1, Y - XCurrent + 1, Color);
+        if (Esp < 0)
+            Esp += 4 * XCurrent + 6;
+        else {
+            if (XCurrent != YCurrent) {
+                Paint_FillArea(Canvas, X - XCurrent, Y + YCurrent, X + XCurrent + 1, Y + YCurrent + 1, Color);
+                Paint_FillArea(Canvas, X - XCurrent, Y - YCurrent, X + XCurrent + 1, Y - YCurrent + 1, Color);
+            }
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+}
+
+#define PAINT_RING_MAX_RADIUS 255
+
+/******************************************************************************
+function: Draw the outline Paint_DrawCircle stamps, one or two spans per row
+parameter:
+    X_Center  ：Center X coordinate
+    Y_Center  ：Center Y coordinate
+    Radius    ：circle Radius, at most PAINT_RING_MAX_RADIUS
+    Color     ：The color of the circle
+    Line_width: Line width
+info:
+    Lo/Hi hold the outline X range of each row of one quadrant. A pixel row
+    R is covered by the outline points on rows [R-w+2, R+w], each stamping
+    columns [X-w, X+w-2]. Only rows inside the clip are visited.
+******************************************************************************/
+static void Paint_DrawRing(PAINT *Canvas, int X_Center, int Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width)
+{
+    UWORD Lo[PAINT_RING_MAX_RADIUS + 1], Hi[PAINT_RING_MAX_RADIUS + 1];
+    for (int i = 0; i <= Radius; i++) {
+        Lo[i] = Radius;
+        Hi[i] = 0;
+    }
+
+    int16_t XCurrent = 0, YCurrent = Radius;
+    int16_t Esp = 3 - (Radius << 1);
+    while (XCurrent <= YCurrent) {
+        if (XCurrent < Lo[YCurrent]) Lo[YCurrent] = XCurrent;
+        if (XCurrent > Hi[YCurrent]) Hi[YCurrent] = XCurrent;
+        if (YCurrent < Lo[XCurrent]) Lo[XCurrent] = YCurrent;
+        if (YCurrent > Hi[XCurrent]) Hi[XCurrent] = YCurrent;
+        if (Esp < 0)
+            Esp += 4 * XCurrent + 6;
+        else {
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+
+    int W = Line_width;
+    int Ymin = Y_Center - Radius;
+    int Ymax = Y_Center + Radius;
+    int RowFirst = Ymin - W > Canvas->Clip.Ystart ? Ymin - W : Canvas->Clip.Ystart;
+    int RowLast = Ymax + W - 2 < Canvas->Clip.Yend - 1 ? Ymax + W - 2 : Canvas->Clip.Yend - 1;
+    for (int Row = RowFirst; Row <= RowLast; Row++) {
+        int From = Row - W + 2 > Ymin ? Row - W + 2 : Ymin;
+        int To = Row + W < Ymax ? Row + W : Ymax;
+        // every row of the window has outline points on both sides
+        int LeftMin = X_Center, LeftMax = X_Center - Radius;
+        int RightMin = X_Center + Radius, RightMax = X_Center;
+        for (int Y = From; Y <= To; Y++) {
+            int D = Y < Y_Center ? Y_Center - Y : Y - Y_Center;
+            if (X_Center - Hi[D] < LeftMin) LeftMin = X_Center - Hi[D];
+            if (X_Center - Lo[D] > LeftMax) LeftMax = X_Center - Lo[D];
+            if (X_Center + Lo[D] < RightMin) RightMin = X_Center + Lo[D];
+            if (X_Center + Hi[D] > RightMax) RightMax = X_Center + Hi[D];
+        }
+        if (LeftMax + W - 1 >= RightMin - W) {
+            Paint_FillArea(Canvas, LeftMin - W, Row, RightMax + W - 1, Row + 1, Color);
+        } else {
+            Paint_FillArea(Canvas, LeftMin - W, Row, LeftMax + W - 1, Row + 1, Color);
+            Paint_FillArea(Canvas, RightMin - W, Row, RightMax + W - 1, Row + 1, Color);
+        }
+    }
+}
+
+/******************************************************************************
+function: Use the 8-point method to draw a circle of the
+            specified size at the specified position->
+parameter:
+    X_Center  ：Center X coordinate
+    Y_Center  ：Center Y coordinate
+    Radius    ：circle Radius
+    Color     ：The color of the ：circle segment
+    Line_width: Line width
+    Draw_Fill : Whether to fill the inside of the Circle
+info:
+    Filled circles and outlines up to PAINT_RING_MAX_RADIUS are rasterized
+    as row spans, larger outlines stamp a point per step.
+******************************************************************************/
+void Canvas_DrawCircle(PAINT *Canvas, UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    int X0 = X_Center - Radius - Line_width, Y0 = Y_Center - Radius - Line_width;
+    int X1 = X_Center + Radius + Line_width - 1, Y1 = Y_Center + Radius + Line_width - 1;
+    if (!Paint_ClipArea(Canvas, &X0, &Y0, &X1, &Y1))
+        return;
+    Paint_MarkArea(Canvas, X0, Y0, X1, Y1);
+
+    if (Draw_Fill == DRAW_FILL_FULL) {
+        Paint_FillDisc(Canvas, X_Center, Y_Center, Radius, Color);
+        return;
+    }
+    if (Radius <= PAINT_RING_MAX_RADIUS) {
+        Paint_DrawRing(Canvas, X_Center, Y_Center, Radius, Color, Line_width);
+        return;
+    }
+
+    //Draw a circle from(0, R) as a starting point
+    int16_t XCurrent, YCurrent;
+    XCurrent = 0;
+    YCurrent = Radius;
+
+    //Cumulative error,judge the next point of the logo
+    int16_t Esp = 3 - (Radius << 1 );
+
+    PAINT_PIXEL_WRITER SetPixel = Canvas_GetPixelWriter(Canvas);
+    while (XCurrent <= YCurrent ) {
+        Paint_DrawPointWith(Canvas, SetPixel, X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
+        Paint_DrawPointWith(Canvas, SetPixel, X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
+        Paint_DrawPointWith(Canvas, SetPixel, X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
+        Paint_DrawPointWith(Canvas, SetPixel, X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
+        Paint_DrawPointWith(Canvas, SetPixel, X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
+        Paint_DrawPointWith(Canvas, SetPixel, X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
+        Paint_DrawPointWith(Canvas, SetPixel, X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
+        Paint_DrawPointWith(Canvas, SetPixel, X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
+
+        if (Esp < 0 )
+            Esp += 4 * XCurrent + 6;
+        else {
+            Esp += 10 + 4 * (XCurrent - YCurrent );
+            YCurrent --;
+        }
+        XCurrent ++;
+    }
+}
+
+/******************************************************************************
+function: Draw a rectangle with rounded corners
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, not drawn
+    Yend   : y end point, not drawn
+    Radius : Corner radius, limited to half the shorter side
+    Color  : The color of the rectangle
+    Line_width : Outline thickness
+    Draw_Fill  : Whether to fill the inside of the rectangle
+info:
+    Corners follow the same midpoint disc as Paint_DrawCircle. An outline
+    is the rectangle minus the one inset by Line_width, each row painted
+    once as at most two spans.
+******************************************************************************/
+void Canvas_DrawRoundRect(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius,
+                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    if (Xstart >= Xend || Ystart >= Yend)
+        return;
+    Paint_MarkArea(Canvas, Xstart, Ystart, Xend, Yend);
+
+    int W = Xend - Xstart, H = Yend - Ystart;
+    int R = Radius;
+    if (R > (W - 1) / 2) R = (W - 1) / 2;
+    if (R > (H - 1) / 2) R = (H - 1) / 2;
+    if (R > PAINT_RING_MAX_RADIUS) R = PAINT_RING_MAX_RADIUS;
+
+    int T = Line_width;
+    bool Hollow = (Draw_Fill == DRAW_FILL_EMPTY && 2 * T < W && 2 * T < H);
+    int Ri = R > T ? R - T : 0;
+
+    UWORD Outer[PAINT_RING_MAX_RADIUS + 1], Inner[PAINT_RING_MAX_RADIUS + 1];
+    Paint_DiscHalfWidths(R, Outer);
+    if (Hollow)
+        Paint_DiscHalfWidths(Ri, Inner);
+
+    for (int Y = Ystart; Y < Yend; Y++) {
+        // distance into the top or bottom corner band, 0 outside of it
+        int D = 0;
+        if (Y < Ystart + R) D = Ystart + R - Y;
+        if (Y > Yend - 1 - R) D = Y - (Yend - 1 - R);
+        int Inset = D ? R - Outer[D] : 0;
+        int X0 = Xstart + Inset, X1 = Xend - Inset;
+
+        if (!Hollow || Y < Ystart + T || Y >= Yend - T) {
+            Paint_FillArea(Canvas, X0, Y, X1, Y + 1, Color);
+            continue;
+        }
+
+        int Di = 0;
+        if (Y < Ystart + T + Ri) Di = Ystart + T + Ri - Y;
+        if (Y > Yend - 1 - T - Ri) Di = Y - (Yend - 1 - T - Ri);
+        int InsetI = T + (Di ? Ri - Inner[Di] : 0);
+        Paint_FillArea(Canvas, X0, Y, Xstart + InsetI, Y + 1, Color);
+        Paint_FillArea(Canvas, Xend - InsetI, Y, X1, Y + 1, Color);
+    }
+}
+
+/******************************************************************************
+function: Merge up to 8 glyph pixels into an image byte
+parameter:
+    Dst         : Image byte
+    Bits        : Glyph pixels, MSB first
+    Mask        : Pixels of Bits to draw
+    Fore / Back : Foreground and background as a full byte
+    Transparent : Leave pixels that are clear in Bits untouched
+******************************************************************************/
+static inline void Paint_MergeGlyphByte(UBYTE *Dst, UBYTE Bits, UBYTE Mask, UBYTE Fore, UBYTE Back, bool Transparent)
+{
+    if (Transparent)
+        Mask &= Bits;
+    *Dst = (*Dst & ~Mask) | (((Bits & Fore) | (~Bits & Back)) & Mask);
+}
+
+/******************************************************************************
+function: Read 8 glyph pixels starting at any bit
+parameter:
+    Glyph : Glyph bits, MSB first
+    Bit   : First pixel
+info:
+    Unaligned reads touch the byte after the first one.
+******************************************************************************/
+static inline UBYTE Paint_GlyphBits(const unsigned char *Glyph, UDOUBLE Bit)
+{
+    const unsigned char *p = Glyph + Bit / 8;
+    UBYTE Shift = Bit % 8;
+    return Shift ? (UBYTE)((p[0] << Shift) | (p[1] >> (8 - Shift))) : p[0];
+}
+
+/**
+ * Row by row reader of a compressed pFONT glyph, Row holds the pixels of
+ * the row decoded last
+**/
+typedef struct {
+    const UBYTE *Src;
+    UBYTE Bit;
+    const pHUFFMAN *Codes;
+    UWORD Run;
+    UBYTE Color;
+    UBYTE Width;
+    UBYTE Row[32];
+} PAINT_RUN_DECODER;
+
+static void Paint_BeginRuns(PAINT_RUN_DECODER *Runs, const pHUFFMAN *Codes, const UBYTE *Src, UBYTE Width)
+{
+    Runs->Src = Src;
+    Runs->Bit = 0x80;
+    Runs->Codes = Codes;
+    Runs->Run = 0;
+    Runs->Color = 1;
+    Runs->Width = Width;
+    memset(Runs->Row, 0, (Width + 7) / 8);
+}
+
+/******************************************************************************
+function: Read one run length
+parameter:
+    Runs : Decoder
+    Code : Canonical Huffman code of the run's colour
+info:
+    Symbol 63 adds 63 pixels and another symbol follows.
+******************************************************************************/
+static UWORD Paint_NextRun(PAINT_RUN_DECODER *Runs, const pHUFFMAN *Code)
+{
+    const UBYTE *Src = Runs->Src;
+    UBYTE Bit = Runs->Bit;
+    UWORD Run = 0;
+    UBYTE Symbol;
+    do {
+        int Value = 0, First = 0, Index = 0;
+        Symbol = 0;
+        for (int Len = 1; Len < 16; Len++) {
+            Value |= (*Src & Bit) ? 1 : 0;
+            Bit >>= 1;
+            if (!Bit) {
+                Bit = 0x80;
+                Src++;
+            }
+            int Count = Code->counts[Len];
+            if (Value - First < Count) {
+                Symbol = Code->symbols[Index + Value - First];
+                break;
+            }
+            Index += Count;
+            First = (First + Count) << 1;
+            Value <<= 1;
+        }
+        Run += Symbol;
+    } while (Symbol == 63);
+    Runs->Src = Src;
+    Runs->Bit = Bit;
+    return Run;
+}
+
+/******************************************************************************
+function: Decode the next glyph row
+parameter:
+    Runs : Decoder
+info:
+    Black runs mark the pixels that differ from the row above, so they are
+    toggled in Row and white runs are skipped.
+******************************************************************************/
+static void Paint_DecodeRow(PAINT_RUN_DECODER *Runs)
+{
+    int X = 0;
+    while (X < Runs->Width) {
+        if (Runs->Run == 0) {
+            Runs->Color ^= 1;
+            Runs->Run = Paint_NextRun(Runs, &Runs->Codes[Runs->Color]);
+            continue;
+        }
+        int N = Runs->Width - X;
+        if (Runs->Run < N)
+            N = Runs->Run;
+        Runs->Run -= N;
+        if (!Runs->Color) {
+            X += N;
+            continue;
+        }
+        while (N > 0) {
+            int Shift = X % 8;
+            int Take = 8 - Shift < N ? 8 - Shift : N;
+            Runs->Row[X / 8] ^= (UBYTE)((0xFF >> Shift) & (0xFF << (8 - Shift - Take)));
+            X += Take;
+            N -= Take;
+        }
+    }
+}
+
+/******************************************************************************
+function: Draw a row packed 1bpp glyph
+parameter:
+    Xpoint           : X coordinate
+    Ypoint           : Y coordinate
+    Glyph            : Rows of Stride bits, MSB first
+    Width            : Glyph width
+    Height           : Glyph height
+    Stride           : Bits from one row to the next, at least Width
+    Runs             : Decoder of a compressed glyph set up by the caller,
+                       NULL to read Glyph
+    Color_Foreground : Color of set bits
+    Color_Background : Color of clear bits, FONT_BACKGROUND leaves them alone
+info:
+    The glyph is clipped to the columns and rows inside the clip. On 1bpp
+    images whose memory rows run left to right each glyph byte is shifted
+    into at most two image bytes. Other layouts draw pixel by pixel.
+    Compressed glyphs are decoded one row at a time right before the row
+    is drawn, rows below the clip are never decoded.
+******************************************************************************/
+static void Paint_DrawGlyph(PAINT *Canvas, int Xpoint, int Ypoint, const unsigned char *Glyph, UWORD Width, UWORD Height,
+                            UWORD Stride, PAINT_RUN_DECODER *Runs, UWORD Color_Foreground, UWORD Color_Background)
+{
+    int X0 = Xpoint, Y0 = Ypoint, X1 = Xpoint + Width, Y1 = Ypoint + Height;
+    if (!Paint_ClipArea(Canvas, &X0, &Y0, &X1, &Y1))
+        return;
+    Paint_MarkArea(Canvas, X0, Y0, X1, Y1);
+
+    bool Transparent = (FONT_BACKGROUND == Color_Background);
+    // visible glyph columns and rows
+    int Col0 = X0 - Xpoint, Col1 = X1 - Xpoint;
+    int Page0 = Y0 - Ypoint, Page1 = Y1 - Ypoint;
+
+    bool Swap = (Canvas->Rotate == ROTATE_90 || Canvas->Rotate == ROTATE_270);
+    bool RevX = (Canvas->Rotate == ROTATE_90 || Canvas->Rotate == ROTATE_180) != ((Canvas->Mirror & MIRROR_HORIZONTAL) != 0);
+    bool RevY = (Canvas->Rotate == ROTATE_180 || Canvas->Rotate == ROTATE_270) != ((Canvas->Mirror & MIRROR_VERTICAL) != 0);
+
+    if (Runs) {
+        for (int Page = 0; Page < Page0; Page++)
+            Paint_DecodeRow(Runs);
+        Glyph = Runs->Row;
+    }
+
+    if (Canvas->Scale != 2 || Swap || RevX) {
+        PAINT_PIXEL_WRITER SetPixel = Canvas_GetPixelWriter(Canvas);
+        for (int Page = Page0; Page < Page1; Page++) {
+            UDOUBLE First = Runs ? 0 : (UDOUBLE)Page * Stride;
+            if (Runs)
+                Paint_DecodeRow(Runs);
+            for (int Column = Col0; Column < Col1; Column++) {
+                UDOUBLE Bit = First + Column;
+                if (Glyph[Bit / 8] & (0x80 >> (Bit % 8)))
+                    SetPixel(Canvas, Xpoint + Column, Ypoint + Page, Color_Foreground);
+                else if (!Transparent)
+                    SetPixel(Canvas, Xpoint + Column, Ypoint + Page, Color_Background);
+            }
+        }
+        return;
+    }
+
+    UBYTE Fore = (Color_Foreground == BLACK) ? 0x00 : 0xFF;
+    UBYTE Back = (Color_Background == BLACK) ? 0x00 : 0xFF;
+    // Xpoint may be left of the canvas, split it into a whole byte and a shift
+    int Base = Xpoint & ~7;
+    UBYTE Shift = Xpoint - Base;
+
+    for (int Page = Page0; Page < Page1; Page++) {
+        int Y = RevY ? Canvas->HeightMemory - 1 - (Ypoint + Page) : Ypoint + Page;
+        UBYTE *Row = Canvas->Image + (UDOUBLE)Y * Canvas->WidthByte;
+        UDOUBLE First = Runs ? 0 : (UDOUBLE)Page * Stride;
+        if (Runs)
+            Paint_DecodeRow(Runs);
+        for (int Column = Col0 & ~7; Column < Col1; Column += 8) {
+            UBYTE Mask = 0xFF;
+            if (Column < Col0) Mask &= 0xFF >> (Col0 - Column);
+            if (Col1 - Column < 8) Mask &= (UBYTE)(0xFF << (8 - (Col1 - Column)));
+            UBYTE Bits = Paint_GlyphBits(Glyph, First + Column);
+            int Index = (Base + Column) / 8;
+            if ((UBYTE)(Mask >> Shift))
+                Paint_MergeGlyphByte(Row + Index, Bits >> Shift, Mask >> Shift, Fore, Back, Transparent);
+            if (Shift && (UBYTE)(Mask << (8 - Shift)))
+                Paint_MergeGlyphByte(Row + Index + 1, Bits << (8 - Shift), Mask << (8 - Shift), Fore, Back, Transparent);
+        }
+    }
+}
+
+/******************************************************************************
+function: Show English characters
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    The tables hold ' ' to '~', other characters are not drawn.
+******************************************************************************/
+void Canvas_DrawChar(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Acsii_Char < ' ' || Acsii_Char > '~')
+        return;
+    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
+    const unsigned char *ptr = &Font->table[Char_Offset];
+
+    Paint_DrawGlyph(Canvas, Xpoint, Ypoint, ptr, Font->Width, Font->Height, (Font->Width + 7) & ~7, NULL,
+                    Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function:	Display the string
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Wraps to Xstart at the right edge of the canvas and stops at the bottom,
+    Text_Layout breaks lines at words and fits a box.
+******************************************************************************/
+void Canvas_DrawString_EN(PAINT *Canvas, UWORD Xstart, UWORD Ystart, const char * pString,
+                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+
+    while (* pString != '\0') {
+        //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
+        if ((Xpoint + Font->Width ) > Canvas->Width ) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+
+        // If the Y direction is full, the rest does not fit
+        if ((Ypoint  + Font->Height ) > Canvas->Height ) {
+            break;
+        }
+        Canvas_DrawChar(Canvas, Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
+
+        //The next character of the address
+        pString ++;
+
+        //The next word of the abscissa increases the font of the broadband
+        Xpoint += Font->Width;
+    }
+}
+
+
+/******************************************************************************
+function: Find the glyph of a code point in a cFONT
+parameter:
+    font : Font to search
+    Code : Unicode code point
+info:
+    Binary search over the generated index, fonts without one are scanned.
+    Returns NULL when the font has no such glyph.
+******************************************************************************/
+static const CH_CN *Paint_FindGlyphCN(const cFONT *font, uint32_t Code)
+{
+    if (font->index) {
+        int Lo = 0, Hi = font->index_size - 1;
+        while (Lo <= Hi) {
+            int Mid = (Lo + Hi) / 2;
+            uint32_t C = font->index[Mid].code;
+            if (C == Code)
+                return &font->table[font->index[Mid].entry];
+            if (C < Code)
+                Lo = Mid + 1;
+            else
+                Hi = Mid - 1;
+        }
+        return NULL;
+    }
+
+    for (int Num = 0; Num < font->size; Num++) {
+        // index holds up to 3 UTF-8 bytes and is not always terminated
+        const unsigned char *Index = font->table[Num].index;
+        char Text[4] = {(char)Index[0], (char)Index[1], (char)Index[2], 0};
+        const char *p = Text;
+        if (Text_DecodeUTF8(&p) == Code)
+            return &font->table[Num];
+    }
+    return NULL;
+}
+
+/******************************************************************************
+function: Display the string
+parameter:
+    Xstart  ：X coordinate
+    Ystart  ：Y coordinate
+    pString ：The first address of the Chinese string and English
+              string to be displayed, UTF-8
+    Font    ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    ASCII advances by ASCII_Width, every other character by Width. Missing
+    glyphs leave their cell empty.
+******************************************************************************/
+void Canvas_DrawString_CN(PAINT *Canvas, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
+                        UWORD Color_Foreground, UWORD Color_Background)
+{
+    const char* p_text = pString;
+    int x = Xstart, y = Ystart;
+
+    /* Send the string character by character on EPD */
+    while (*p_text != 0) {
+        uint32_t Code = Text_DecodeUTF8(&p_text);
+        const CH_CN *Glyph = Paint_FindGlyphCN(font, Code);
+        if (Glyph)
+            Paint_DrawGlyph(Canvas, x, y, (const unsigned char *)Glyph->matrix, font->Width, font->Height,
+                            (font->Width + 7) & ~7, NULL, Color_Foreground, Color_Background);
+        x += Code < 0x80 ? font->ASCII_Width : font->Width;
+    }
+}
+
+/******************************************************************************
+function: Draw one glyph of a pFONT
+parameter:
+    Font  : Font made by font-pack.py
+    Index : Glyph index
+    Xpen  : X of the pen
+    Ytop  : Y of the top of the line
+    Color : Color of the ink, the rest of the ink box is left alone
+******************************************************************************/
+static void Paint_DrawGlyphPK(PAINT *Canvas, const pFONT *Font, int Index, int Xpen, int Ytop, UWORD Color)
+{
+    const pGLYPH *Glyph = &Font->glyphs[Index];
+    if (Glyph->width == 0)
+        return;
+
+    PAINT_RUN_DECODER Runs;
+    if (Font->runs)
+        Paint_BeginRuns(&Runs, Font->runs, Font->bitmap + Glyph->offset, Glyph->width);
+    Paint_DrawGlyph(Canvas, Xpen + Glyph->left, Ytop + Glyph->top, Font->bitmap + Glyph->offset,
+                    Glyph->width, Glyph->height, Glyph->width, Font->runs ? &Runs : NULL,
+                    Color, FONT_BACKGROUND);
+}
+
+/******************************************************************************
+function: Width of a string in a proportional font
+parameter:
+    pString : UTF-8 string
+    Font    : Font to measure with
+info:
+    Sum of the advances and kerning, the distance Canvas_DrawText moves the
+    pen. Ink may reach a little past it on either side.
+******************************************************************************/
+UWORD Paint_TextWidth(const char *pString, const pFONT *Font)
+{
+    int Width = 0, Prev = -1;
+    while (*pString != 0) {
+        int Glyph = Text_NextGlyph(Font, &pString);
+        if (Glyph < 0)
+            continue;
+        if (Prev >= 0)
+            Width += Text_Kerning(Font, Prev, Glyph);
+        Width += Font->glyphs[Glyph].advance;
+        Prev = Glyph;
+    }
+    return Width > 0 ? Width : 0;
+}
+
+/******************************************************************************
+function: Display a string in a proportional font
+parameter:
+    Xstart           : X of the pen at the start of the line
+    Ystart           : Y of the top of the line, the baseline is Font->Ascent below
+    pString          : UTF-8 string
+    Font             : Font made by font-pack.py
+    Color_Foreground : Color of the glyphs
+    Color_Background : Fills the line box behind the string, FONT_BACKGROUND
+                       leaves it alone
+info:
+    Only the ink box of each glyph is drawn and glyphs are moved closer or
+    apart by the kerning table, so neighbours may overlap. Glyphs of
+    compressed fonts are decoded while they are drawn.
+******************************************************************************/
+void Canvas_DrawText(PAINT *Canvas, UWORD Xstart, UWORD Ystart, const char *pString, pFONT *Font,
+                     UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Color_Background != FONT_BACKGROUND) {
+        int Xend = Xstart + Paint_TextWidth(pString, Font);
+        Paint_MarkArea(Canvas, Xstart, Ystart, Xend, Ystart + Font->Height);
+        Paint_FillArea(Canvas, Xstart, Ystart, Xend, Ystart + Font->Height, Color_Background);
+    }
+
+    int x = Xstart, Prev = -1;
+    while (*pString != 0) {
+        int Index = Text_NextGlyph(Font, &pString);
+        if (Index < 0)
+            continue;
+        if (Prev >= 0)
+            x += Text_Kerning(Font, Prev, Index);
+        Paint_DrawGlyphPK(Canvas, Font, Index, x, Ystart, Color_Foreground);
+        x += Font->glyphs[Index].advance;
+        Prev = Index;
+    }
+}
+
+/******************************************************************************
+function: Display text laid out by Text_Layout
+parameter:
+    Layout           : Glyph positions made by Text_Layout
+    Xstart           : X of the top left corner of the box
+    Ystart           : Y of the top left corner of the box
+    Color_Foreground : Color of the glyphs
+    Color_Background : Fills the whole box behind the text, FONT_BACKGROUND
+                       leaves it alone
+info:
+    Nothing is measured or looked up, every glyph is drawn where the layout
+    put it.
+******************************************************************************/
+void Canvas_DrawLayout(PAINT *Canvas, const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart,
+                       UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Color_Background != FONT_BACKGROUND) {
+        int Xend = Xstart + Layout->BoxWidth, Yend = Ystart + Layout->BoxHeight;
+        Paint_MarkArea(Canvas, Xstart, Ystart, Xend, Yend);
+        Paint_FillArea(Canvas, Xstart, Ystart, Xend, Yend, Color_Background);
+    }
+
+    for (UWORD i = 0; i < Layout->Count; i++) {
+        const TEXT_GLYPH *Placed = &Layout->Glyphs[i];
+        Paint_DrawGlyphPK(Canvas, Layout->Font, Placed->Glyph, Xstart + Placed->X, Ystart + Placed->Y,
+                          Color_Foreground);
+    }
+}
+
+/******************************************************************************
+function:	Display nummber
+parameter:
+    Xstart           ：X coordinate
+    Ystart           : Y coordinate
+    Nummber          : The number displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Negative numbers get a '-', zero is drawn as "0".
+******************************************************************************/
+void Canvas_DrawNum(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
+                   sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    // sign, 10 digits of a 32-bit value and the terminator
+    char Str_Array[12];
+    char *pStr = Str_Array + sizeof(Str_Array) - 1;
+    uint32_t Rest = Nummber < 0 ? 0u - (uint32_t)Nummber : (uint32_t)Nummber;
+
+    //Converts a number to a string, from the last digit backwards
+    *pStr = '\0';
+    do {
+        *--pStr = '0' + Rest % 10;
+        Rest /= 10;
+    } while (Rest != 0);
+    if (Nummber < 0)
+        *--pStr = '-';
+
+    //show
+    Canvas_DrawString_EN(Canvas, Xpoint, Ypoint, pStr, Font, Color_Background, Color_Foreground);
+}
+
+/******************************************************************************
+function:	Display time
+parameter:
+    Xstart           ：X coordinate
+    Ystart           : Y coordinate
+    pTime            : Time-related structures
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Canvas_DrawTime(PAINT *Canvas, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
+                    UWORD Color_Foreground, UWORD Color_Background)
+{
+    uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    UWORD Dx = Font->Width;
+
+    //Write data into the cache
+    Canvas_DrawChar(Canvas, Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
+    Canvas_DrawChar(Canvas, Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
+    Canvas_DrawChar(Canvas, Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
+    Canvas_DrawChar(Canvas, Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
+    Canvas_DrawChar(Canvas, Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
+    Canvas_DrawChar(Canvas, Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
+    Canvas_DrawChar(Canvas, Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
+    Canvas_DrawChar(Canvas, Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
+}
+
+/******************************************************************************
+function:	Display monochrome bitmap
 parameter:
     image_buffer ：A picture data converted to a bitmap
 info:
     Use a computer to convert the image into a corresponding array,
     and then embed the array directly into Imagedata.cpp as a .c file.
+    While a clip is pushed only the pixels inside of it are copied.
 ******************************************************************************/
-void Paint_DrawBitMap(const unsigned char* image_buffer)
+void Canvas_DrawBitMap(PAINT *Canvas, const unsigned char* image_buffer)
+{
+    const PAINT_RECT *Clip = &Canvas->Clip;
+    int X0, Y0, X1, Y1;
+    if (!Paint_MapArea(Canvas, Clip->Xstart, Clip->Ystart, Clip->Xend, Clip->Yend, &X0, &Y0, &X1, &Y1))
+        return;
+    Paint_MarkArea(Canvas, Clip->Xstart, Clip->Ystart, Clip->Xend, Clip->Yend);
+    if (Clip->Xstart == 0 && Clip->Ystart == 0 && Clip->Xend == Canvas->Width && Clip->Yend == Canvas->Height) {
+        Buffer_Copy(Canvas->Image, image_buffer, (UDOUBLE)Canvas->WidthByte * Canvas->HeightByte);
+        return;
+    }
+
+    UBYTE Pattern;
+    UBYTE Bpp = Paint_ScalePattern(Canvas, WHITE, &Pattern);
+    if (Bpp == 0)
+        return;
+    UBYTE Ppb = 8 / Bpp;
+    UWORD First = X0 / Ppb;
+    UWORD Last = (X1 - 1) / Ppb;
+    UBYTE HeadMask = 0xFF >> ((X0 % Ppb) * Bpp);
+    UBYTE TailMask = 0xFF << ((Ppb - 1 - (X1 - 1) % Ppb) * Bpp);
+    for (int Y = Y0; Y < Y1; Y++) {
+        UBYTE *Row = Canvas->Image + (UDOUBLE)Y * Canvas->WidthByte;
+        const unsigned char *Src = image_buffer + (UDOUBLE)Y * Canvas->WidthByte;
+        for (UWORD B = First; B <= Last; B++) {
+            UBYTE Mask = 0xFF;
+            if (B == First) Mask &= HeadMask;
+            if (B == Last) Mask &= TailMask;
+            if (Mask == 0xFF && B < Last) {
+                memcpy(Row + B, Src + B, Last - B);
+                B = Last - 1;
+                continue;
+            }
+            Row[B] = (Row[B] & ~Mask) | (Src[B] & Mask);
+        }
+    }
+}
+
+/******************************************************************************
+function: Read 8 pixels of a packed 1bpp row
+parameter:
+    Row    : Row of the image
+    Stride : Bytes in the row
+    Offset : First pixel, may be negative or past the row
+info:
+    Pixels outside of the row read as 0.
+******************************************************************************/
+static inline UBYTE Paint_FetchBits(const unsigned char *Row, UWORD Stride, int Offset)
+{
+    int Shift = Offset & 7;
+    int Index = (Offset - Shift) / 8;
+    UBYTE Hi = (Index >= 0 && Index < Stride) ? Row[Index] : 0;
+    if (Shift == 0)
+        return Hi;
+    UBYTE Lo = (Index + 1 >= 0 && Index + 1 < Stride) ? Row[Index + 1] : 0;
+    return (UBYTE)((Hi << Shift) | (Lo >> (8 - Shift)));
+}
+
+static inline UBYTE Paint_RasterOp(UBYTE Dst, UBYTE Src, BLIT_OP Op)
+{
+    switch (Op) {
+    case BLIT_OR:  return Dst | Src;
+    case BLIT_AND: return Dst & Src;
+    case BLIT_XOR: return Dst ^ Src;
+    default:       return Src;
+    }
+}
+
+/******************************************************************************
+function: Combine whole canvas bytes with image pixels
+parameter:
+    Dst    : First canvas byte
+    Src    : Image row
+    Offset : Image pixel landing on the MSB of Dst, not negative
+    Len    : Bytes to write, all of them covered by the image
+******************************************************************************/
+static void Paint_BlitInner(UBYTE *Dst, const unsigned char *Src, int Offset, int Len, BLIT_OP Op)
+{
+    const unsigned char *S = Src + Offset / 8;
+    UBYTE Shift = Offset % 8;
+    if (Shift == 0 && Op == BLIT_COPY) {
+        memcpy(Dst, S, Len);
+        return;
+    }
+    for (int i = 0; i < Len; i++) {
+        UBYTE Bits = Shift ? (UBYTE)((S[i] << Shift) | (S[i + 1] >> (8 - Shift))) : S[i];
+        switch (Op) {
+        case BLIT_OR:  Dst[i] |= Bits; break;
+        case BLIT_AND: Dst[i] &= Bits; break;
+        case BLIT_XOR: Dst[i] ^= Bits; break;
+        default:       Dst[i] = Bits; break;
+        }
+    }
+}
+
+/******************************************************************************
+function: Blit a 1bpp image
+parameter:
+    image_buffer : Image, rows of (W_Image + 7) / 8 bytes, MSB first
+    mask_buffer  : Same layout, only pixels set here are drawn, NULL for all
+    xStart       : X of the top left corner, may be off canvas
+    yStart       : Y of the top left corner, may be off canvas
+    W_Image      : Image width
+    H_Image      : Image height
+    Op           : How image pixels combine with the canvas
+info:
+    The image is clipped and follows rotation and mirroring.
+    When memory rows run left to right on a 1bpp canvas every image byte is
+    shifted across two canvas bytes, otherwise pixels are mapped one by one.
+    On gray canvases image pixels are drawn as WHITE or BLACK, the raster
+    operation is always BLIT_COPY.
+******************************************************************************/
+void Canvas_BlitImage(PAINT *Canvas, const unsigned char *image_buffer, const unsigned char *mask_buffer,
+                     int xStart, int yStart, UWORD W_Image, UWORD H_Image, BLIT_OP Op)
 {
-    UWORD x, y;
-    UDOUBLE Addr = 0;
+    int X0 = xStart, Y0 = yStart, X1 = xStart + W_Image, Y1 = yStart + H_Image;
+    if (!Paint_ClipArea(Canvas, &X0, &Y0, &X1, &Y1))
+        return;
+    Paint_MarkArea(Canvas, X0, Y0, X1, Y1);
+
+    UWORD Stride = W_Image / 8 + (W_Image % 8 ? 1 : 0);
+    bool Swap = (Canvas->Rotate == ROTATE_90 || Canvas->Rotate == ROTATE_270);
+    bool RevX = (Canvas->Rotate == ROTATE_90 || Canvas->Rotate == ROTATE_180) != ((Canvas->Mirror & MIRROR_HORIZONTAL) != 0);
+    bool RevY = (Canvas->Rotate == ROTATE_180 || Canvas->Rotate == ROTATE_270) != ((Canvas->Mirror & MIRROR_VERTICAL) != 0);
+
+    if (Canvas->Scale != 2) {
+        PAINT_PIXEL_WRITER SetPixel = Canvas_GetPixelWriter(Canvas);
+        for (int y = Y0; y < Y1; y++) {
+            const unsigned char *Src = image_buffer + (UDOUBLE)(y - yStart) * Stride;
+            const unsigned char *Mask = mask_buffer ? mask_buffer + (UDOUBLE)(y - yStart) * Stride : NULL;
+            for (int x = X0; x < X1; x++) {
+                int i = x - xStart;
+                if (Mask && !(Mask[i / 8] & (0x80 >> (i % 8))))
+                    continue;
+                SetPixel(Canvas, x, y, (Src[i / 8] & (0x80 >> (i % 8))) ? WHITE : BLACK);
+            }
+        }
+        return;
+    }
+
+    if (Swap || RevX) {
+        for (int y = Y0; y < Y1; y++) {
+            const unsigned char *Src = image_buffer + (UDOUBLE)(y - yStart) * Stride;
+            const unsigned char *Mask = mask_buffer ? mask_buffer + (UDOUBLE)(y - yStart) * Stride : NULL;
+            for (int x = X0; x < X1; x++) {
+                int i = x - xStart;
+                UBYTE Bit = 0x80 >> (i % 8);
+                if (Mask && !(Mask[i / 8] & Bit))
+                    continue;
+                int SrcX = Swap ? y : x, SrcY = Swap ? x : y;
+                int X = RevX ? Canvas->WidthMemory - 1 - SrcX : SrcX;
+                int Y = RevY ? Canvas->HeightMemory - 1 - SrcY : SrcY;
+                UBYTE *Dst = Canvas->Image + X / 8 + (UDOUBLE)Y * Canvas->WidthByte;
+                UBYTE DstBit = 0x80 >> (X % 8);
+                UBYTE Value = Paint_RasterOp(*Dst, (Src[i / 8] & Bit) ? 0xFF : 0x00, Op);
+                *Dst = (*Dst & ~DstBit) | (Value & DstBit);
+            }
+        }
+        return;
+    }
 
-    for (y = 0; y < Paint.HeightByte; y++) {
-        for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * Paint.WidthByte;
-            Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
+    int First = X0 / 8, Last = (X1 - 1) / 8;
+    UBYTE HeadMask = 0xFF >> (X0 % 8);
+    UBYTE TailMask = 0xFF << (7 - (X1 - 1) % 8);
+    for (int y = Y0; y < Y1; y++) {
+        const unsigned char *Src = image_buffer + (UDOUBLE)(y - yStart) * Stride;
+        const unsigned char *Mask = mask_buffer ? mask_buffer + (UDOUBLE)(y - yStart) * Stride : NULL;
+        int Y = RevY ? Canvas->HeightMemory - 1 - y : y;
+        UBYTE *Row = Canvas->Image + (UDOUBLE)Y * Canvas->WidthByte;
+        for (int B = First; B <= Last; B++) {
+            // unmasked inner bytes lie wholly inside the image row
+            if (!Mask && B > First && B < Last) {
+                Paint_BlitInner(Row + B, Src, B * 8 - xStart, Last - B, Op);
+                B = Last - 1;
+                continue;
+            }
+            int Offset = B * 8 - xStart;
+            UBYTE Edge = 0xFF;
+            if (B == First) Edge &= HeadMask;
+            if (B == Last) Edge &= TailMask;
+            if (Mask)
+                Edge &= Paint_FetchBits(Mask, Stride, Offset);
+            if (Edge == 0)
+                continue;
+            UBYTE Value = Paint_RasterOp(Row[B], Paint_FetchBits(Src, Stride, Offset), Op);
+            Row[B] = (Row[B] & ~Edge) | (Value & Edge);
         }
     }
 }
@@ -797,18 +2076,236 @@ parameter:
     yStart           : Y starting coordinates
     xEnd             ：Image width
     yEnd             : Image height
+info:
+    Copies the image with Paint_BlitImage, any X offset is allowed.
 ******************************************************************************/
-void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
+void Canvas_DrawImage(PAINT *Canvas, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
 {
-    UWORD x, y;
-	UWORD w_byte=(W_Image%8)?(W_Image/8)+1:W_Image/8;
-    UDOUBLE Addr = 0;
-	UDOUBLE pAddr = 0;
-    for (y = 0; y < H_Image; y++) {
-        for (x = 0; x < w_byte; x++) {//8 pixel =  1 byte
-            Addr = x + y * w_byte;
-			pAddr=x+(xStart/8)+((y+yStart)*Paint.WidthByte);
-            Paint.Image[pAddr] = (unsigned char)image_buffer[Addr];
-        }
+    Canvas_BlitImage(Canvas, image_buffer, NULL, xStart, yStart, W_Image, H_Image, BLIT_COPY);
+}
+
+/******************************************************************************
+function:	Composite one canvas onto another
+parameter:
+    Dst     : Canvas drawn on
+    Src     : Canvas whose image memory is copied
+    Mask    : Canvas selecting the Src pixels to combine, or NULL for all
+    xStart  : X starting coordinates on Dst
+    yStart  : Y starting coordinates on Dst
+    Op      : How Src and Dst pixels are combined
+info:
+    Src and Mask must be 1bpp and are read as stored in memory, their own
+    rotation and mirroring are already part of the image. The copy follows
+    the rotation and mirroring of Dst like Canvas_BlitImage.
+******************************************************************************/
+void Canvas_Compose(PAINT *Dst, const PAINT *Src, const PAINT *Mask, int xStart, int yStart, BLIT_OP Op)
+{
+    if (Src->Scale != 2 || (Mask && (Mask->Scale != 2 ||
+        Mask->WidthMemory != Src->WidthMemory || Mask->HeightMemory != Src->HeightMemory))) {
+        Debug("Canvas_Compose needs 1bpp canvases of the same size\r\n");
+        return;
+    }
+    Canvas_BlitImage(Dst, Src->Image, Mask ? Mask->Image : NULL,
+                     xStart, yStart, Src->WidthMemory, Src->HeightMemory, Op);
+}
+
+/******************************************************************************
+function:	Find where two canvases differ
+parameter:
+    A      : First canvas
+    B      : Second canvas, same memory size and scale as A
+    Bounds : Receives the memory rectangle holding every changed byte
+info:
+    Bounds is in memory coordinates with X on whole bytes, ends not
+    included, like the PAINT Dirty rectangles. Returns false when the
+    images are equal or the canvases do not match.
+******************************************************************************/
+bool Canvas_Diff(const PAINT *A, const PAINT *B, PAINT_RECT *Bounds)
+{
+    if (A->Scale != B->Scale || A->WidthByte != B->WidthByte || A->HeightByte != B->HeightByte)
+        return false;
+
+    int First = A->WidthByte, Last = -1, Top = -1, Bottom = -1;
+    for (int y = 0; y < A->HeightByte; y++) {
+        const UBYTE *RowA = A->Image + (UDOUBLE)y * A->WidthByte;
+        const UBYTE *RowB = B->Image + (UDOUBLE)y * B->WidthByte;
+        if (memcmp(RowA, RowB, A->WidthByte) == 0)
+            continue;
+        int L = 0, R = A->WidthByte - 1;
+        while (RowA[L] == RowB[L]) L++;
+        while (RowA[R] == RowB[R]) R--;
+        if (L < First) First = L;
+        if (R > Last) Last = R;
+        if (Top < 0) Top = y;
+        Bottom = y;
     }
+    if (Top < 0)
+        return false;
+
+    UBYTE Pixels = A->Scale == 2 ? 8 : (A->Scale == 4 ? 4 : 2);
+    Bounds->Xstart = (First * Pixels) & ~7;
+    Bounds->Xend = ((Last + 1) * Pixels + 7) & ~7;
+    Bounds->Ystart = Top;
+    Bounds->Yend = Bottom + 1;
+    return true;
+}
+
+/******************************************************************************
+The Paint_ functions draw on the global Paint canvas
+******************************************************************************/
+void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+{
+    Canvas_NewImage(&Paint, image, Width, Height, Rotate, Color);
+}
+
+void Paint_SelectImage(UBYTE *image)
+{
+    Canvas_SelectImage(&Paint, image);
+}
+
+void Paint_SetRotate(UWORD Rotate)
+{
+    Canvas_SetRotate(&Paint, Rotate);
+}
+
+void Paint_SetMirroring(UBYTE mirror)
+{
+    Canvas_SetMirroring(&Paint, mirror);
+}
+
+void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    Canvas_SetPixel(&Paint, Xpoint, Ypoint, Color);
+}
+
+PAINT_PIXEL_WRITER Paint_GetPixelWriter(void)
+{
+    return Canvas_GetPixelWriter(&Paint);
+}
+
+void Paint_SetScale(UBYTE scale)
+{
+    Canvas_SetScale(&Paint, scale);
+}
+
+void Paint_Clear(UWORD Color)
+{
+    Canvas_Clear(&Paint, Color);
+}
+
+void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    Canvas_ClearWindows(&Paint, Xstart, Ystart, Xend, Yend, Color);
+}
+
+void Paint_FillRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    Canvas_FillRect(&Paint, Xstart, Ystart, Xend, Yend, Color);
+}
+
+void Paint_MarkDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    Canvas_MarkDirty(&Paint, Xstart, Ystart, Xend, Yend);
+}
+
+void Paint_ResetDirty(void)
+{
+    Canvas_ResetDirty(&Paint);
+}
+
+bool Paint_PushClip(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    return Canvas_PushClip(&Paint, Xstart, Ystart, Xend, Yend);
+}
+
+void Paint_PopClip(void)
+{
+    Canvas_PopClip(&Paint);
+}
+
+void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    Canvas_DrawPoint(&Paint, Xpoint, Ypoint, Color, Dot_Pixel, Dot_Style);
+}
+
+void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                    UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    Canvas_DrawLine(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Line_Style);
+}
+
+void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    Canvas_DrawRectangle(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                      UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    Canvas_DrawCircle(&Paint, X_Center, Y_Center, Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawRoundRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius,
+                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    Canvas_DrawRoundRect(&Paint, Xstart, Ystart, Xend, Yend, Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Canvas_DrawChar(&Paint, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
+                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Canvas_DrawString_EN(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
+                         UWORD Color_Foreground, UWORD Color_Background)
+{
+    Canvas_DrawString_CN(&Paint, Xstart, Ystart, pString, font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawText(UWORD Xstart, UWORD Ystart, const char *pString, pFONT *Font,
+                    UWORD Color_Foreground, UWORD Color_Background)
+{
+    Canvas_DrawText(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawLayout(const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart,
+                      UWORD Color_Foreground, UWORD Color_Background)
+{
+    Canvas_DrawLayout(&Paint, Layout, Xstart, Ystart, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
+                   sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    Canvas_DrawNum(&Paint, Xpoint, Ypoint, Nummber, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
+                    UWORD Color_Foreground, UWORD Color_Background)
+{
+    Canvas_DrawTime(&Paint, Xstart, Ystart, pTime, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawBitMap(const unsigned char* image_buffer)
+{
+    Canvas_DrawBitMap(&Paint, image_buffer);
+}
+
+void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    Canvas_DrawImage(&Paint, image_buffer, xStart, yStart, W_Image, H_Image);
+}
+
+void Paint_BlitImage(const unsigned char *image_buffer, const unsigned char *mask_buffer,
+                     int xStart, int yStart, UWORD W_Image, UWORD H_Image, BLIT_OP Op)
+{
+    Canvas_BlitImage(&Paint, image_buffer, mask_buffer, xStart, yStart, W_Image, H_Image, Op);
 }
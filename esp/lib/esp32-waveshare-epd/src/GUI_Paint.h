@@ -81,6 +81,26 @@
 #include "utility/Debug.h"
 #include "DEV_Config.h"
 #include "fonts.h"
+#include "GUI_Text.h"
+
+/**
+ * Rectangle, ends not included. Changed regions are in memory coordinates
+ * with X on whole bytes, clip rectangles in canvas coordinates
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+} PAINT_RECT;
+
+#ifndef PAINT_DIRTY_MAX
+#define PAINT_DIRTY_MAX 4
+#endif
+
+#ifndef PAINT_CLIP_DEPTH
+#define PAINT_CLIP_DEPTH 4
+#endif
 
 /**
  * Image attributes
@@ -97,9 +117,20 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
+    PAINT_RECT Dirty[PAINT_DIRTY_MAX];
+    UBYTE DirtyCount;
+    UBYTE DirtyLast;
+    PAINT_RECT Clip;
+    PAINT_RECT ClipStack[PAINT_CLIP_DEPTH];
+    UBYTE ClipDepth;
 } PAINT;
 extern PAINT Paint;
 
+/**
+ * Pixel writer specialized for the configuration of one canvas
+**/
+typedef void (*PAINT_PIXEL_WRITER)(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+
 /**
  * Display rotate
 **/
@@ -175,6 +206,16 @@ typedef enum {
     DRAW_FILL_FULL,
 } DRAW_FILL;
 
+/**
+ * How Paint_BlitImage combines image and canvas pixels
+**/
+typedef enum {
+    BLIT_COPY = 0,
+    BLIT_OR,
+    BLIT_AND,
+    BLIT_XOR,
+} BLIT_OP;
+
 /**
  * Custom structure of a time attribute
 **/
@@ -194,27 +235,83 @@ void Paint_SelectImage(UBYTE *image);
 void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
+PAINT_PIXEL_WRITER Paint_GetPixelWriter(void);
 void Paint_SetScale(UBYTE scale);
 
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Paint_FillRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+
+//Changed regions
+void Paint_MarkDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Paint_ResetDirty(void);
+
+//Clipping
+bool Paint_PushClip(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Paint_PopClip(void);
 
 //Drawing
 void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
 void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
 void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawRoundRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 
 //Display string
 void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawText(UWORD Xstart, UWORD Ystart, const char *pString, pFONT *Font, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_TextWidth(const char *pString, const pFONT *Font);
+void Paint_DrawLayout(const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 
 //pic
 void Paint_DrawBitMap(const unsigned char* image_buffer);
 void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image); 
+void Paint_BlitImage(const unsigned char *image_buffer, const unsigned char *mask_buffer,
+                     int xStart, int yStart, UWORD W_Image, UWORD H_Image, BLIT_OP Op);
+
+//Canvas contexts, the Paint_ functions above draw on the global Paint
+void Canvas_NewImage(PAINT *Canvas, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
+void Canvas_SelectImage(PAINT *Canvas, UBYTE *image);
+void Canvas_SetRotate(PAINT *Canvas, UWORD Rotate);
+void Canvas_SetMirroring(PAINT *Canvas, UBYTE mirror);
+void Canvas_SetPixel(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+PAINT_PIXEL_WRITER Canvas_GetPixelWriter(PAINT *Canvas);
+void Canvas_SetScale(PAINT *Canvas, UBYTE scale);
+
+void Canvas_Clear(PAINT *Canvas, UWORD Color);
+void Canvas_ClearWindows(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Canvas_FillRect(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Canvas_MarkDirty(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Canvas_ResetDirty(PAINT *Canvas);
+bool Canvas_PushClip(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Canvas_PopClip(PAINT *Canvas);
+
+void Canvas_DrawPoint(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
+void Canvas_DrawLine(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+void Canvas_DrawRectangle(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Canvas_DrawCircle(PAINT *Canvas, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Canvas_DrawRoundRect(PAINT *Canvas, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+
+void Canvas_DrawChar(PAINT *Canvas, UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Canvas_DrawString_EN(PAINT *Canvas, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Canvas_DrawString_CN(PAINT *Canvas, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
+void Canvas_DrawText(PAINT *Canvas, UWORD Xstart, UWORD Ystart, const char *pString, pFONT *Font, UWORD Color_Foreground, UWORD Color_Background);
+void Canvas_DrawLayout(PAINT *Canvas, const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart, UWORD Color_Foreground, UWORD Color_Background);
+void Canvas_DrawNum(PAINT *Canvas, UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Canvas_DrawTime(PAINT *Canvas, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+
+void Canvas_DrawBitMap(PAINT *Canvas, const unsigned char* image_buffer);
+void Canvas_DrawImage(PAINT *Canvas, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+void Canvas_BlitImage(PAINT *Canvas, const unsigned char *image_buffer, const unsigned char *mask_buffer,
+                      int xStart, int yStart, UWORD W_Image, UWORD H_Image, BLIT_OP Op);
+
+//Compositing
+void Canvas_Compose(PAINT *Dst, const PAINT *Src, const PAINT *Mask, int xStart, int yStart, BLIT_OP Op);
+bool Canvas_Diff(const PAINT *A, const PAINT *B, PAINT_RECT *Bounds);
 
 #endif
 
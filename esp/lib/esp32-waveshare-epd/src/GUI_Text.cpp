@@ -0,0 +1,320 @@
+/*****************************************************************************
+* | File      	:   GUI_Text.cpp
+* | Function    :   Measuring and laying out text in pFONT fonts
+* | Info        :
+*   UTF-8 decoding, glyph lookup, kerning and line breaking inside a box.
+*   A TEXT_LAYOUT keeps the position of every glyph, drawing it with
+*   Paint_DrawLayout only blits
+*----------------
+******************************************************************************/
+#include "GUI_Text.h"
+
+/******************************************************************************
+function: Decode one UTF-8 character
+parameter:
+    pText : Text pointer, moved past the character
+info:
+    Malformed sequences decode as U+FFFD and only their first byte is
+    consumed. A NUL byte never counts as a continuation byte.
+******************************************************************************/
+uint32_t Text_DecodeUTF8(const char **pText)
+{
+    const unsigned char *p = (const unsigned char *)*pText;
+    uint32_t Code;
+    int Len;
+    if (p[0] < 0x80) {
+        *pText += 1;
+        return p[0];
+    } else if (p[0] >= 0xC2 && p[0] <= 0xDF) {
+        Code = p[0] & 0x1F;
+        Len = 2;
+    } else if (p[0] >= 0xE0 && p[0] <= 0xEF) {
+        Code = p[0] & 0x0F;
+        Len = 3;
+    } else if (p[0] >= 0xF0 && p[0] <= 0xF4) {
+        Code = p[0] & 0x07;
+        Len = 4;
+    } else {
+        *pText += 1;
+        return 0xFFFD;
+    }
+    for (int i = 1; i < Len; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            *pText += 1;
+            return 0xFFFD;
+        }
+        Code = (Code << 6) | (p[i] & 0x3F);
+    }
+    // overlong forms, surrogates and values past U+10FFFF
+    if ((Len == 3 && Code < 0x800) || (Len == 4 && (Code < 0x10000 || Code > 0x10FFFF)) ||
+        (Code >= 0xD800 && Code <= 0xDFFF)) {
+        *pText += 1;
+        return 0xFFFD;
+    }
+    *pText += Len;
+    return Code;
+}
+
+/******************************************************************************
+function: Find the glyph of a code point in a pFONT
+parameter:
+    Font : Font to search
+    Code : Unicode code point
+info:
+    Returns the pGLYPH index, -1 when the font has no such glyph.
+******************************************************************************/
+int Text_FindGlyph(const pFONT *Font, uint32_t Code)
+{
+    for (int i = 0; i < Font->range_count; i++) {
+        const pRANGE *Range = &Font->ranges[i];
+        if (Code >= Range->first && Code - Range->first < Range->count)
+            return Range->glyph + (Code - Range->first);
+    }
+    return -1;
+}
+
+/******************************************************************************
+function: Decode the next character of a string into a pFONT glyph
+parameter:
+    Font  : Font to search
+    pText : Text pointer, moved past the character
+info:
+    Characters the font lacks are shown as '?', -1 when that is missing too.
+******************************************************************************/
+int Text_NextGlyph(const pFONT *Font, const char **pText)
+{
+    int Glyph = Text_FindGlyph(Font, Text_DecodeUTF8(pText));
+    return Glyph < 0 ? Text_FindGlyph(Font, '?') : Glyph;
+}
+
+/******************************************************************************
+function: Kerning between two glyphs of a pFONT
+parameter:
+    Left  : pGLYPH index of the first glyph
+    Right : pGLYPH index of the glyph after it
+info:
+    Binary search over the sorted pairs, 0 for pairs that are not kerned.
+******************************************************************************/
+int Text_Kerning(const pFONT *Font, int Left, int Right)
+{
+    uint32_t Key = (uint32_t)Left << 16 | Right;
+    int Lo = 0, Hi = Font->kerning_count - 1;
+    while (Lo <= Hi) {
+        int Mid = (Lo + Hi) / 2;
+        uint32_t K = (uint32_t)Font->kerning[Mid].left << 16 | Font->kerning[Mid].right;
+        if (K == Key)
+            return Font->kerning[Mid].offset;
+        if (K < Key)
+            Lo = Mid + 1;
+        else
+            Hi = Mid - 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function: Hash the text of a layout
+parameter:
+    pString : UTF-8 text
+info:
+    32-bit FNV-1a, used to tell whether the text changed since the last
+    layout.
+******************************************************************************/
+static UDOUBLE Text_Key(const char *pString)
+{
+    UDOUBLE Key = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)pString; *p != 0; p++)
+        Key = (Key ^ *p) * 16777619u;
+    return Key;
+}
+
+/******************************************************************************
+function: Finish a line
+parameter:
+    Layout    : Layout being built
+    LineStart : First glyph of the line
+    Pen       : Pen position at the end of the line
+info:
+    Moves the glyphs of the line to its alignment and counts the line.
+******************************************************************************/
+static void Text_EndLine(TEXT_LAYOUT *Layout, UWORD LineStart, int Pen)
+{
+    int Shift = 0;
+    if (Layout->Align == TEXT_ALIGN_CENTER)
+        Shift = (Layout->BoxWidth - Pen) / 2;
+    else if (Layout->Align == TEXT_ALIGN_RIGHT)
+        Shift = Layout->BoxWidth - Pen;
+    if (Shift > 0) {
+        for (UWORD i = LineStart; i < Layout->Count; i++)
+            Layout->Glyphs[i].X += Shift;
+    }
+    if (Pen > Layout->Width)
+        Layout->Width = Pen;
+    Layout->Lines++;
+    Layout->Height = Layout->Lines * Layout->Font->Height;
+}
+
+/******************************************************************************
+function: End a line with an ellipsis
+parameter:
+    Layout    : Layout being built
+    LineStart : First glyph of the line
+    Pen       : Pen position at the end of the line, moved past the ellipsis
+    Y         : Top of the line
+info:
+    Uses U+2026 when the font has it and three dots otherwise. Glyphs are
+    dropped from the end of the line until the ellipsis fits the box and
+    the glyph array.
+******************************************************************************/
+static void Text_Ellipsis(TEXT_LAYOUT *Layout, UWORD LineStart, int *Pen, int Y)
+{
+    const pFONT *Font = Layout->Font;
+    int Dot = Text_FindGlyph(Font, 0x2026);
+    int Dots = 1;
+    if (Dot < 0) {
+        Dot = Text_FindGlyph(Font, '.');
+        Dots = 3;
+    }
+    Layout->Truncated = true;
+    if (Dot < 0)
+        return;
+
+    int Width = Dots * Font->glyphs[Dot].advance;
+    for (;;) {
+        // spaces have no entry, the ellipsis follows the last glyph directly
+        if (Layout->Count > LineStart) {
+            const TEXT_GLYPH *Last = &Layout->Glyphs[Layout->Count - 1];
+            *Pen = Last->X + Font->glyphs[Last->Glyph].advance;
+        } else {
+            *Pen = 0;
+        }
+        if ((*Pen + Width <= Layout->BoxWidth && Layout->Count + Dots <= TEXT_LAYOUT_GLYPHS) ||
+            Layout->Count == LineStart)
+            break;
+        Layout->Count--;
+    }
+    if (*Pen + Width > Layout->BoxWidth || Layout->Count + Dots > TEXT_LAYOUT_GLYPHS)
+        return;
+    for (int i = 0; i < Dots; i++) {
+        TEXT_GLYPH *Placed = &Layout->Glyphs[Layout->Count++];
+        Placed->X = *Pen;
+        Placed->Y = Y;
+        Placed->Glyph = Dot;
+        *Pen += Font->glyphs[Dot].advance;
+    }
+}
+
+/******************************************************************************
+function: Lay out text inside a box
+parameter:
+    Layout  : Receives the glyph positions and keeps them between calls
+    pString : UTF-8 text, '\n' starts a new line
+    Font    : Font to lay out with
+    Width   : Box width
+    Height  : Box height, only whole lines of Font->Height are used
+    Align   : Alignment of each line inside the box
+info:
+    Lines break after spaces, '-' and '/', words wider than the box break
+    between any two characters. Text past the last line that fits, or past
+    TEXT_LAYOUT_GLYPHS glyphs, is cut and the last line ends with an
+    ellipsis. Returns false and keeps the glyphs when the layout already
+    holds the same text, font, box and alignment.
+******************************************************************************/
+bool Text_Layout(TEXT_LAYOUT *Layout, const char *pString, const pFONT *Font, UWORD Width, UWORD Height, TEXT_ALIGN Align)
+{
+    UDOUBLE Key = Text_Key(pString);
+    if (Layout->Font == Font && Layout->Key == Key && Layout->BoxWidth == Width && Layout->BoxHeight == Height &&
+        Layout->Align == Align)
+        return false;
+
+    Layout->Font = Font;
+    Layout->BoxWidth = Width;
+    Layout->BoxHeight = Height;
+    Layout->Align = Align;
+    Layout->Key = Key;
+    Layout->Width = 0;
+    Layout->Height = 0;
+    Layout->Lines = 0;
+    Layout->Truncated = false;
+    Layout->Count = 0;
+
+    int MaxLines = Font->Height ? Height / Font->Height : 0;
+    const char *p = pString;
+    while (*p != 0) {
+        if (Layout->Lines >= MaxLines) {
+            Layout->Truncated = true;
+            break;
+        }
+        int Y = Layout->Lines * Font->Height;
+        UWORD LineStart = Layout->Count;
+        int Pen = 0, Prev = -1;
+        // last break opportunity, where the next line would start
+        const char *Break = NULL;
+        UWORD BreakCount = 0;
+        int BreakPen = 0;
+        // the line ends at a newline or the end of the text unless Full
+        const char *Next = p;
+        bool Full = false, Packed = false;
+
+        while (*Next != 0) {
+            const char *q = Next;
+            uint32_t Code = Text_DecodeUTF8(&q);
+            if (Code == '\n') {
+                Next = q;
+                break;
+            }
+            int Index = Text_FindGlyph(Font, Code);
+            if (Index < 0)
+                Index = Text_FindGlyph(Font, '?');
+            if (Index < 0) {
+                Next = q;
+                continue;
+            }
+            const pGLYPH *Glyph = &Font->glyphs[Index];
+            int X = Pen + (Prev >= 0 ? Text_Kerning(Font, Prev, Index) : 0);
+            if (Code == ' ') {
+                Break = q;
+                BreakCount = Layout->Count;
+                BreakPen = Pen;
+            } else if (X + Glyph->advance > Width && Next != p) {
+                Full = true;
+                break;
+            } else if (Glyph->width && Layout->Count == TEXT_LAYOUT_GLYPHS) {
+                Full = Packed = true;
+                break;
+            }
+            if (Glyph->width) {
+                TEXT_GLYPH *Placed = &Layout->Glyphs[Layout->Count++];
+                Placed->X = X;
+                Placed->Y = Y;
+                Placed->Glyph = Index;
+            }
+            Pen = X + Glyph->advance;
+            Prev = Index;
+            Next = q;
+            if (Code == '-' || Code == '/') {
+                Break = q;
+                BreakCount = Layout->Count;
+                BreakPen = Pen;
+            }
+        }
+
+        if ((Packed || Layout->Lines + 1 == MaxLines) && *Next != 0) {
+            Text_Ellipsis(Layout, LineStart, &Pen, Y);
+            Text_EndLine(Layout, LineStart, Pen);
+            break;
+        }
+        if (Full && Break) {
+            Layout->Count = BreakCount;
+            Pen = BreakPen;
+            Next = Break;
+        }
+        Text_EndLine(Layout, LineStart, Pen);
+        p = Next;
+        if (Full) {
+            while (*p == ' ')
+                p++;
+        }
+    }
+    return true;
+}
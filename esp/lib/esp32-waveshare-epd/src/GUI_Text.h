@@ -0,0 +1,62 @@
+/*****************************************************************************
+* | File      	:   GUI_Text.h
+* | Function    :   Measuring and laying out text in pFONT fonts
+* | Info        :
+*   UTF-8 decoding, glyph lookup, kerning and line breaking inside a box.
+*   A TEXT_LAYOUT keeps the position of every glyph, drawing it with
+*   Paint_DrawLayout only blits
+*----------------
+******************************************************************************/
+#ifndef __GUI_TEXT_H
+#define __GUI_TEXT_H
+
+#include "DEV_Config.h"
+#include "fonts.h"
+
+#ifndef TEXT_LAYOUT_GLYPHS
+#define TEXT_LAYOUT_GLYPHS 128
+#endif
+
+/**
+ * Horizontal alignment of the lines inside the box
+**/
+typedef enum {
+    TEXT_ALIGN_LEFT = 0,
+    TEXT_ALIGN_CENTER,
+    TEXT_ALIGN_RIGHT,
+} TEXT_ALIGN;
+
+/**
+ * Glyph placed in the box, pen position relative to the top left corner
+**/
+typedef struct {
+    int16_t X;
+    int16_t Y;
+    uint16_t Glyph;
+} TEXT_GLYPH;
+
+/**
+ * Laid out text, glyphs without ink such as spaces are left out
+**/
+typedef struct {
+    const pFONT *Font;
+    UWORD BoxWidth;
+    UWORD BoxHeight;
+    TEXT_ALIGN Align;
+    UDOUBLE Key;
+    UWORD Width;
+    UWORD Height;
+    UBYTE Lines;
+    bool Truncated;
+    UWORD Count;
+    TEXT_GLYPH Glyphs[TEXT_LAYOUT_GLYPHS];
+} TEXT_LAYOUT;
+
+uint32_t Text_DecodeUTF8(const char **pText);
+int Text_FindGlyph(const pFONT *Font, uint32_t Code);
+int Text_NextGlyph(const pFONT *Font, const char **pText);
+int Text_Kerning(const pFONT *Font, int Left, int Right);
+
+bool Text_Layout(TEXT_LAYOUT *Layout, const char *pString, const pFONT *Font, UWORD Width, UWORD Height, TEXT_ALIGN Align);
+
+#endif
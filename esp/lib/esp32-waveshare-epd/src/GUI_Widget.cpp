@@ -0,0 +1,186 @@
+/*****************************************************************************
+* | File      	:   GUI_Widget.cpp
+* | Function    :   Numbers and clocks that redraw only what changed
+* | Info        :
+*   A widget remembers the character shown in each of its cells. Drawing a
+*   new value redraws only the cells whose character changed, so only they
+*   are marked dirty and a partial refresh covers just those digits
+*----------------
+******************************************************************************/
+#include "GUI_Widget.h"
+#include <string.h>
+
+/******************************************************************************
+function: Set up the common fields of a widget
+******************************************************************************/
+static void Widget_Init(WIDGET_DIGITS *Widget, UWORD Xstart, UWORD Ystart, UBYTE Count, sFONT *Font,
+                        UWORD Color_Foreground, UWORD Color_Background)
+{
+    Widget->Font = Font;
+    Widget->Xstart = Xstart;
+    Widget->Ystart = Ystart;
+    Widget->Color_Foreground = Color_Foreground;
+    Widget->Color_Background = Color_Background;
+    Widget->Count = Count;
+    Widget_Invalidate(Widget);
+}
+
+/******************************************************************************
+function: Set up a number widget
+parameter:
+    Xstart           : X of the left edge
+    Ystart           : Y of the top edge
+    Digits           : Number of cells, including the sign
+    Font             : Font of the digits
+    Color_Foreground : Color of the digits
+    Color_Background : Color of the cells behind them
+info:
+    Numbers are right aligned in cells of Font->Width.
+******************************************************************************/
+void Widget_InitNum(WIDGET_DIGITS *Widget, UWORD Xstart, UWORD Ystart, UBYTE Digits, sFONT *Font,
+                    UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Digits < 1)
+        Digits = 1;
+    if (Digits > WIDGET_CELLS)
+        Digits = WIDGET_CELLS;
+    Widget_Init(Widget, Xstart, Ystart, Digits, Font, Color_Foreground, Color_Background);
+    for (UBYTE i = 0; i < Digits; i++)
+        Widget->Glyph[i] = i * Font->Width;
+}
+
+/******************************************************************************
+function: Set up a HH:MM:SS clock widget
+parameter:
+    Xstart           : X of the left edge
+    Ystart           : Y of the top edge
+    Font             : Font of the digits
+    Color_Foreground : Color of the digits
+    Color_Background : Color of the cells behind them
+info:
+    Glyphs sit where Paint_DrawTime puts them, so the colon cells overlap
+    the digits next to them.
+******************************************************************************/
+void Widget_InitTime(WIDGET_DIGITS *Widget, UWORD Xstart, UWORD Ystart, sFONT *Font,
+                     UWORD Color_Foreground, UWORD Color_Background)
+{
+    int Dx = Font->Width;
+    const int Glyph[8] = {0, Dx, Dx + Dx / 4 + Dx / 2, Dx * 2 + Dx / 2, Dx * 3 + Dx / 2, Dx * 4 + Dx / 2 - Dx / 4,
+                          Dx * 5, Dx * 6};
+
+    Widget_Init(Widget, Xstart, Ystart, 8, Font, Color_Foreground, Color_Background);
+    for (UBYTE i = 0; i < 8; i++)
+        Widget->Glyph[i] = Glyph[i];
+}
+
+/******************************************************************************
+function: Forget what the widget shows
+info:
+    The next draw redraws every cell, e.g. after the canvas was cleared.
+******************************************************************************/
+void Widget_Invalidate(WIDGET_DIGITS *Widget)
+{
+    memset(Widget->Shown, 0, sizeof(Widget->Shown));
+    memset(&Widget->Changed, 0, sizeof(Widget->Changed));
+}
+
+/******************************************************************************
+function: Redraw the cells whose character changed
+parameter:
+    Canvas : Canvas to draw on
+    Widget : Widget to update
+    Text   : Widget->Count characters, one per cell
+info:
+    A changed cell is repainted inside a clip of the cell: filled, then
+    every glyph overlapping it is drawn in order, which gives the same
+    pixels as drawing the whole row again. Returns the number of cells
+    redrawn, Widget->Changed covers them.
+******************************************************************************/
+static UBYTE Widget_Update(PAINT *Canvas, WIDGET_DIGITS *Widget, const char *Text)
+{
+    UBYTE Drawn = 0;
+    memset(&Widget->Changed, 0, sizeof(Widget->Changed));
+    for (UBYTE i = 0; i < Widget->Count; i++) {
+        if (Widget->Shown[i] == Text[i])
+            continue;
+
+        UWORD Width = Widget->Font->Width;
+        UWORD Xstart = Widget->Xstart + Widget->Glyph[i], Xend = Xstart + Width;
+        UWORD Ystart = Widget->Ystart, Yend = Widget->Ystart + Widget->Font->Height;
+        if (!Canvas_PushClip(Canvas, Xstart, Ystart, Xend, Yend))
+            break;
+        // opaque glyphs cover the whole cell themselves
+        if (Widget->Color_Background == FONT_BACKGROUND)
+            Canvas_ClearWindows(Canvas, Xstart, Ystart, Xend, Yend, Widget->Color_Background);
+        for (UBYTE j = 0; j < Widget->Count; j++) {
+            if (Widget->Glyph[j] < Widget->Glyph[i] + Width && Widget->Glyph[j] + Width > Widget->Glyph[i])
+                Canvas_DrawChar(Canvas, Widget->Xstart + Widget->Glyph[j], Ystart, Text[j], Widget->Font,
+                                Widget->Color_Foreground, Widget->Color_Background);
+        }
+        Canvas_PopClip(Canvas);
+
+        Widget->Shown[i] = Text[i];
+        if (Drawn++ == 0) {
+            Widget->Changed.Xstart = Xstart;
+            Widget->Changed.Ystart = Ystart;
+            Widget->Changed.Yend = Yend;
+        }
+        if (Xend > Widget->Changed.Xend)
+            Widget->Changed.Xend = Xend;
+    }
+    return Drawn;
+}
+
+/******************************************************************************
+function: Show a number, redrawing only the digits that changed
+parameter:
+    Canvas : Canvas to draw on
+    Widget : Made by Widget_InitNum
+    Number : Number to show
+info:
+    Numbers that need more cells than the widget has show '#' in every cell.
+    Returns the number of cells redrawn.
+******************************************************************************/
+UBYTE Widget_DrawNum(PAINT *Canvas, WIDGET_DIGITS *Widget, int32_t Number)
+{
+    char Text[WIDGET_CELLS];
+    uint32_t Rest = Number < 0 ? 0u - (uint32_t)Number : (uint32_t)Number;
+    int i = Widget->Count;
+    do {
+        Text[--i] = '0' + Rest % 10;
+        Rest /= 10;
+    } while (Rest != 0 && i > 0);
+
+    bool Fits = (Rest == 0);
+    if (Number < 0) {
+        if (i > 0)
+            Text[--i] = '-';
+        else
+            Fits = false;
+    }
+    if (!Fits)
+        memset(Text, '#', Widget->Count);
+    else
+        memset(Text, ' ', i);
+    return Widget_Update(Canvas, Widget, Text);
+}
+
+/******************************************************************************
+function: Show a time, redrawing only the digits that changed
+parameter:
+    Canvas : Canvas to draw on
+    Widget : Made by Widget_InitTime
+    pTime  : Time to show, Hour, Min and Sec are used
+info:
+    Returns the number of cells redrawn, at most two when the minute
+    changes and the seconds stay the same.
+******************************************************************************/
+UBYTE Widget_DrawTime(PAINT *Canvas, WIDGET_DIGITS *Widget, const PAINT_TIME *pTime)
+{
+    const char Text[8] = {
+        (char)('0' + pTime->Hour / 10), (char)('0' + pTime->Hour % 10), ':',
+        (char)('0' + pTime->Min / 10), (char)('0' + pTime->Min % 10), ':',
+        (char)('0' + pTime->Sec / 10), (char)('0' + pTime->Sec % 10),
+    };
+    return Widget_Update(Canvas, Widget, Text);
+}
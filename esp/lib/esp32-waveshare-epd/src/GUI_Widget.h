@@ -0,0 +1,43 @@
+/*****************************************************************************
+* | File      	:   GUI_Widget.h
+* | Function    :   Numbers and clocks that redraw only what changed
+* | Info        :
+*   A widget remembers the character shown in each of its cells. Drawing a
+*   new value redraws only the cells whose character changed, so only they
+*   are marked dirty and a partial refresh covers just those digits
+*----------------
+******************************************************************************/
+#ifndef __GUI_WIDGET_H
+#define __GUI_WIDGET_H
+
+#include "GUI_Paint.h"
+
+#ifndef WIDGET_CELLS
+#define WIDGET_CELLS 12
+#endif
+
+/**
+ * Row of character cells, cell i is Font->Width wide at Glyph[i] from
+ * Xstart. Cells may overlap, like the colons of the clock
+**/
+typedef struct {
+    sFONT *Font;
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Color_Foreground;
+    UWORD Color_Background;
+    UBYTE Count;
+    UWORD Glyph[WIDGET_CELLS];
+    char Shown[WIDGET_CELLS];   // 0 until the cell is drawn
+    PAINT_RECT Changed;         // cells redrawn by the last draw, canvas coordinates
+} WIDGET_DIGITS;
+
+void Widget_InitNum(WIDGET_DIGITS *Widget, UWORD Xstart, UWORD Ystart, UBYTE Digits, sFONT *Font,
+                    UWORD Color_Foreground, UWORD Color_Background);
+void Widget_InitTime(WIDGET_DIGITS *Widget, UWORD Xstart, UWORD Ystart, sFONT *Font,
+                     UWORD Color_Foreground, UWORD Color_Background);
+void Widget_Invalidate(WIDGET_DIGITS *Widget);
+UBYTE Widget_DrawNum(PAINT *Canvas, WIDGET_DIGITS *Widget, int32_t Number);
+UBYTE Widget_DrawTime(PAINT *Canvas, WIDGET_DIGITS *Widget, const PAINT_TIME *pTime);
+
+#endif
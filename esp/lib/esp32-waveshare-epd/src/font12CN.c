@@ -108,12 +108,16 @@ const CH_CN Font12CN_Table[] =
 0xE0,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
 };
 
+#include "font12CN_index.h"
+
 cFONT Font12CN = {
   Font12CN_Table,
   sizeof(Font12CN_Table)/sizeof(CH_CN),  /*size of table*/
   11, /* ASCII Width */
   16, /* Width */
   21, /* Height */
+  Font12CN_Index,
+  sizeof(Font12CN_Index)/sizeof(CH_CN_INDEX),  /*size of index*/
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
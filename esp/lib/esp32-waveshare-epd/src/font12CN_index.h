@@ -0,0 +1,12 @@
+/* Generated by font-index.py from font12CN.c, do not edit */
+static const CH_CN_INDEX Font12CN_Index[] = {
+  {0x0041,   8}, /* A */
+  {0x0061,   5}, /* a */
+  {0x0062,   6}, /* b */
+  {0x0063,   7}, /* c */
+  {0x4F60,   0}, /* 你 */
+  {0x597D,   1}, /* 好 */
+  {0x6811,   2}, /* 树 */
+  {0x6D3E,   4}, /* 派 */
+  {0x8393,   3}, /* 莓 */
+};
@@ -453,12 +453,16 @@ const CH_CN Font24CN_Table[]  =
 
 };
 
+#include "font24CN_index.h"
+
 cFONT Font24CN = {
   Font24CN_Table,
   sizeof(Font24CN_Table)/sizeof(CH_CN),  /*size of table*/
   24, /* ASCII Width */
   32, /* Width */
   41, /* Height */
+  Font24CN_Index,
+  sizeof(Font24CN_Index)/sizeof(CH_CN_INDEX),  /*size of index*/
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
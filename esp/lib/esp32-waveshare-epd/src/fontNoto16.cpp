@@ -0,0 +1,760 @@
+/* Generated by font-pack.py from NotoSans.ttf at 16 px, do not edit */
+#include "fonts.h"
+
+static const uint8_t FontNoto16_Bitmap[] = {
+  0xAA, 0xAA, 0x0F, 0xD9, 0x99, 0x09, 0x02, 0x41, 0x90, 0x44, 0x7F, 0xC4, 0x81, 0x23, 0xFE, 0x22,
+  0x09, 0x02, 0x40, 0x90, 0x10, 0x21, 0xFC, 0x89, 0x1A, 0x1C, 0x0E, 0x12, 0x24, 0x5F, 0xE1, 0x02,
+  0x00, 0x70, 0xC9, 0x88, 0x89, 0x88, 0xB0, 0x8B, 0x09, 0xEE, 0x77, 0x30, 0xD1, 0x0D, 0x11, 0x91,
+  0x11, 0x33, 0x0E, 0x3C, 0x08, 0x41, 0x08, 0x23, 0x02, 0xC0, 0x70, 0x1F, 0x16, 0x76, 0x87, 0xD0,
+  0x33, 0x0F, 0x3E, 0x30, 0xEA, 0x29, 0x69, 0x24, 0x92, 0x24, 0xC8, 0x89, 0x32, 0x49, 0x24, 0xA5,
+  0xA0, 0x10, 0x22, 0x4F, 0xF3, 0x8D, 0x1B, 0x00, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x10, 0x10, 0x10,
+  0xFA, 0xF0, 0xF0, 0x0C, 0x20, 0x86, 0x10, 0xC3, 0x08, 0x61, 0x04, 0x30, 0x38, 0x8A, 0x0C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x05, 0x11, 0xC0, 0x17, 0xD1, 0x11, 0x11, 0x11, 0x11, 0x7C, 0xC6, 0x02,
+  0x02, 0x02, 0x04, 0x0C, 0x18, 0x10, 0x20, 0x40, 0xFF, 0x7C, 0x46, 0x02, 0x02, 0x06, 0x38, 0x06,
+  0x01, 0x01, 0x01, 0x82, 0x7C, 0x02, 0x06, 0x0A, 0x1A, 0x12, 0x22, 0x62, 0xC2, 0xFF, 0x02, 0x02,
+  0x02, 0x7C, 0x81, 0x06, 0x0C, 0x1F, 0x01, 0x81, 0x02, 0x06, 0x17, 0xC0, 0x1C, 0xC1, 0x04, 0x08,
+  0x17, 0xB1, 0xC1, 0x83, 0x05, 0x11, 0xC0, 0xFF, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x0C, 0x08, 0x18,
+  0x10, 0x30, 0x20, 0x3C, 0xCD, 0x0A, 0x16, 0x47, 0x1B, 0x63, 0x83, 0x07, 0x1B, 0xE0, 0x38, 0x8A,
+  0x0C, 0x18, 0x38, 0xDE, 0x81, 0x02, 0x08, 0x33, 0x80, 0xF0, 0x03, 0xC0, 0x6C, 0x00, 0x03, 0x4B,
+  0x00, 0x03, 0x06, 0x18, 0x60, 0xC0, 0x38, 0x0E, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x80, 0xE0, 0x38,
+  0x06, 0x07, 0x1C, 0x70, 0x80, 0xF0, 0x42, 0x11, 0x99, 0x88, 0x40, 0x18, 0xC0, 0x0F, 0x83, 0x04,
+  0x60, 0x24, 0x79, 0x88, 0x99, 0x09, 0x90, 0x99, 0x09, 0x99, 0xB8, 0xE6, 0x40, 0x02, 0x00, 0x1F,
+  0x80, 0x0C, 0x03, 0x00, 0xE0, 0x68, 0x12, 0x0C, 0xC2, 0x10, 0xFE, 0x60, 0x90, 0x24, 0x0F, 0x01,
+  0xFC, 0x86, 0x82, 0x82, 0x86, 0xF8, 0x86, 0x81, 0x81, 0x81, 0x82, 0xFC, 0x1F, 0x21, 0x40, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x60, 0x1F, 0xFC, 0x41, 0xA0, 0x50, 0x18, 0x0C, 0x06, 0x03,
+  0x01, 0x81, 0xC0, 0xA1, 0x9F, 0x80, 0xFE, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0xFE,
+  0x08, 0x20, 0x82, 0x0F, 0xE0, 0x82, 0x08, 0x20, 0x1F, 0x90, 0x50, 0x10, 0x08, 0x04, 0x02, 0x1F,
+  0x01, 0x80, 0xA0, 0x58, 0x23, 0xF0, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0F, 0xFE, 0x03, 0x01, 0x80,
+  0xC0, 0x60, 0x30, 0x10, 0xF2, 0x22, 0x22, 0x22, 0x22, 0x2F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0xE0, 0x82, 0x84, 0x8C, 0x98, 0xB0, 0xE0, 0xF0, 0x98, 0x88, 0x8C, 0x86, 0x83, 0x82, 0x08,
+  0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x3F, 0xC0, 0x78, 0x0F, 0x83, 0xD0, 0x5B, 0x0B, 0x62, 0x64,
+  0x4C, 0xD9, 0x8A, 0x31, 0x46, 0x38, 0xC2, 0x10, 0xC0, 0xE0, 0x78, 0x36, 0x19, 0x0C, 0xC6, 0x33,
+  0x09, 0x86, 0xC1, 0xE0, 0x70, 0x30, 0x1E, 0x18, 0x64, 0x0A, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x50, 0x26, 0x18, 0x78, 0xF9, 0x0E, 0x0C, 0x18, 0x30, 0xBE, 0x40, 0x81, 0x02, 0x04, 0x00,
+  0x1E, 0x18, 0x64, 0x0A, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x50, 0x26, 0x18, 0x7C, 0x03,
+  0x00, 0x60, 0x0C, 0xFC, 0x86, 0x82, 0x82, 0x82, 0x84, 0xF8, 0x8C, 0x8C, 0x86, 0x82, 0x83, 0x3F,
+  0x86, 0x04, 0x0C, 0x0F, 0x07, 0x03, 0x02, 0x06, 0x17, 0xC0, 0xFF, 0x84, 0x02, 0x01, 0x00, 0x80,
+  0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+  0x01, 0x80, 0xC0, 0x50, 0x47, 0xC0, 0xC0, 0xA0, 0x50, 0x6C, 0x22, 0x11, 0x18, 0xC8, 0x24, 0x16,
+  0x0E, 0x03, 0x01, 0x80, 0xC3, 0x06, 0x87, 0x09, 0x0E, 0x13, 0x14, 0x66, 0x68, 0xC4, 0xD9, 0x09,
+  0x12, 0x1A, 0x2C, 0x3C, 0x78, 0x30, 0xE0, 0x60, 0xC0, 0xC1, 0x80, 0x41, 0xB0, 0x88, 0xC6, 0xC1,
+  0xC0, 0x60, 0x70, 0x2C, 0x32, 0x11, 0x90, 0x58, 0x30, 0xC1, 0xA0, 0x98, 0xC4, 0x43, 0x40, 0xA0,
+  0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0xFF, 0x03, 0x06, 0x04, 0x0C, 0x18, 0x18, 0x30, 0x20,
+  0x60, 0xC0, 0xFF, 0xF2, 0x49, 0x24, 0x92, 0x49, 0xC0, 0xC1, 0x04, 0x18, 0x20, 0x83, 0x04, 0x18,
+  0x20, 0x83, 0xE4, 0x92, 0x49, 0x24, 0x93, 0xC0, 0x10, 0x20, 0xA1, 0x44, 0x48, 0xB0, 0xC1, 0xFE,
+  0x99, 0x80, 0x7C, 0x8C, 0x08, 0x17, 0xF8, 0x60, 0xC3, 0x7A, 0x81, 0x02, 0x05, 0xCC, 0x50, 0x60,
+  0xC1, 0x83, 0x07, 0x15, 0xC0, 0x3D, 0x08, 0x20, 0x82, 0x08, 0x10, 0x3C, 0x02, 0x04, 0x09, 0xD4,
+  0x70, 0x60, 0xC1, 0x83, 0x05, 0x19, 0xD0, 0x38, 0x8A, 0x0C, 0x1F, 0xF0, 0x20, 0x21, 0x3E, 0x1C,
+  0x82, 0x3F, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x3A, 0x8E, 0x0C, 0x18, 0x30, 0x60, 0xA3, 0x3A,
+  0x04, 0x0C, 0x2F, 0xC0, 0x81, 0x02, 0x05, 0xEC, 0x70, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x10, 0xDF,
+  0xF0, 0x24, 0x12, 0x49, 0x24, 0x92, 0x4E, 0x82, 0x08, 0x23, 0x9A, 0x4A, 0x38, 0x92, 0x68, 0xE1,
+  0xFF, 0xF0, 0xBC, 0xF6, 0x38, 0xE0, 0x83, 0x04, 0x18, 0x20, 0xC1, 0x06, 0x08, 0x30, 0x41, 0x82,
+  0x08, 0xBD, 0x8E, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x82, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x42, 0x3C, 0xB9, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xE2, 0xB9, 0x02, 0x04, 0x08, 0x00, 0x3A, 0x8E,
+  0x0C, 0x18, 0x30, 0x60, 0xA3, 0x3A, 0x04, 0x08, 0x10, 0x20, 0xBE, 0x21, 0x08, 0x42, 0x10, 0x80,
+  0x7E, 0x18, 0x38, 0x38, 0x30, 0x61, 0xF8, 0x42, 0x3E, 0x84, 0x21, 0x08, 0x42, 0x0E, 0x83, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0xE3, 0x7A, 0xC3, 0x43, 0x42, 0x66, 0x26, 0x24, 0x3C, 0x18, 0x18, 0xC6,
+  0x14, 0x71, 0x45, 0x34, 0xD2, 0x69, 0x22, 0x9A, 0x28, 0xE3, 0x8C, 0x30, 0xC0, 0x87, 0x99, 0xA1,
+  0xC3, 0x07, 0x1A, 0x62, 0x86, 0xC3, 0xC2, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x10,
+  0x30, 0xE0, 0xFC, 0x31, 0x84, 0x30, 0x84, 0x30, 0xFC, 0x19, 0x08, 0x42, 0x13, 0x04, 0x21, 0x08,
+  0x42, 0x0C, 0xFF, 0xFF, 0xC0, 0x82, 0x08, 0x20, 0x81, 0xCC, 0x20, 0x82, 0x08, 0x23, 0x00, 0xF1,
+  0x8F, 0xF0, 0xAA, 0xAA, 0x10, 0xF4, 0x20, 0x82, 0x08, 0x20, 0x40, 0xF1, 0x04, 0x1E, 0x30, 0x20,
+  0x20, 0x20, 0x20, 0xFC, 0x20, 0x20, 0x20, 0x60, 0xFF, 0xFF, 0x38, 0x61, 0xCF, 0xF0, 0xC1, 0x43,
+  0x42, 0x26, 0x24, 0x1C, 0x7E, 0x08, 0x08, 0x7E, 0x08, 0x08, 0xFC, 0x3F, 0x7E, 0x18, 0x18, 0xDA,
+  0x18, 0x5F, 0x1C, 0x10, 0x7E, 0x90, 0x1F, 0x03, 0x0C, 0x4F, 0x2C, 0x82, 0x90, 0x19, 0x01, 0x90,
+  0x19, 0x01, 0xC8, 0x34, 0xF2, 0x30, 0xC1, 0xF8, 0xF1, 0xF9, 0xF0, 0x24, 0x49, 0x24, 0xC4, 0x8D,
+  0x89, 0x80, 0xFE, 0x04, 0x08, 0x10, 0xF0, 0x1F, 0x03, 0x0C, 0x4E, 0x2C, 0x92, 0x89, 0x18, 0x91,
+  0x8E, 0x18, 0xA1, 0xC9, 0x34, 0x9A, 0x30, 0xC1, 0xF8, 0xFF, 0x74, 0x63, 0x17, 0x00, 0x10, 0x10,
+  0x10, 0x10, 0xFF, 0x10, 0x10, 0x10, 0x00, 0xFF, 0x69, 0x12, 0x64, 0xF0, 0x70, 0x42, 0x60, 0x87,
+  0xC0, 0x6A, 0x00, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE3, 0xFB, 0x02, 0x04, 0x08, 0x00, 0x3F,
+  0xBE, 0x5F, 0x3F, 0x9F, 0xCB, 0xE5, 0xF2, 0x79, 0x04, 0x82, 0x41, 0x20, 0x90, 0x48, 0x24, 0x12,
+  0xF0, 0x4C, 0xE0, 0x7C, 0x92, 0x48, 0x74, 0x63, 0x18, 0xB8, 0x48, 0x90, 0x91, 0xB2, 0x4D, 0xB2,
+  0x00, 0x60, 0x9C, 0x30, 0x84, 0x11, 0x02, 0x20, 0x48, 0x89, 0x30, 0x4A, 0x1A, 0x42, 0x7C, 0x81,
+  0x10, 0x20, 0x61, 0x9C, 0x20, 0x8C, 0x11, 0x02, 0x60, 0x4B, 0x8A, 0x08, 0x41, 0x10, 0x46, 0x10,
+  0x84, 0x31, 0xF0, 0x70, 0x40, 0x84, 0x08, 0x87, 0x08, 0x09, 0x00, 0xB2, 0xF2, 0x60, 0x4A, 0x05,
+  0x20, 0x9F, 0x08, 0x21, 0x02, 0x18, 0x60, 0x04, 0x10, 0xC6, 0x30, 0x82, 0x0C, 0x1F, 0x18, 0x02,
+  0x00, 0x40, 0x00, 0x0C, 0x03, 0x00, 0xE0, 0x68, 0x12, 0x0C, 0xC2, 0x10, 0xFE, 0x60, 0x90, 0x24,
+  0x0F, 0x01, 0x02, 0x01, 0x80, 0xC0, 0x00, 0x0C, 0x03, 0x00, 0xE0, 0x68, 0x12, 0x0C, 0xC2, 0x10,
+  0xFE, 0x60, 0x90, 0x24, 0x0F, 0x01, 0x0C, 0x03, 0x81, 0x20, 0x00, 0x0C, 0x03, 0x00, 0xE0, 0x68,
+  0x12, 0x0C, 0xC2, 0x10, 0xFE, 0x60, 0x90, 0x24, 0x0F, 0x01, 0x19, 0x09, 0x80, 0x00, 0x30, 0x0C,
+  0x03, 0x81, 0xA0, 0x48, 0x33, 0x08, 0x43, 0xF9, 0x82, 0x40, 0x90, 0x3C, 0x04, 0x12, 0x00, 0x00,
+  0x00, 0x30, 0x0C, 0x07, 0x81, 0x20, 0x48, 0x33, 0x08, 0x43, 0xF1, 0x86, 0x40, 0x90, 0x2C, 0x0C,
+  0x0C, 0x04, 0x81, 0x20, 0x30, 0x0C, 0x07, 0x81, 0x20, 0x48, 0x33, 0x08, 0x47, 0xF9, 0x02, 0x40,
+  0xB0, 0x38, 0x04, 0x07, 0xF8, 0x28, 0x02, 0x40, 0x12, 0x01, 0x90, 0x08, 0xFC, 0xC4, 0x07, 0xE0,
+  0x61, 0x02, 0x08, 0x30, 0x41, 0x83, 0xF0, 0x1F, 0x21, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x40, 0x60, 0x1F, 0x04, 0x06, 0x02, 0x1C, 0x60, 0x83, 0x00, 0xFE, 0x08, 0x20, 0x83, 0xF8, 0x20,
+  0x82, 0x08, 0x3F, 0x08, 0x63, 0x00, 0xFE, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0x31,
+  0xC4, 0x80, 0xFE, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0x48, 0x00, 0x3F, 0x82, 0x08,
+  0x20, 0xFE, 0x08, 0x20, 0x82, 0x0F, 0xC0, 0xC6, 0x20, 0xF2, 0x22, 0x22, 0x22, 0x22, 0x2F, 0x11,
+  0x20, 0xF2, 0x22, 0x22, 0x22, 0x22, 0x2F, 0x27, 0x90, 0xF2, 0x22, 0x22, 0x22, 0x22, 0x2F, 0x90,
+  0x0F, 0x22, 0x22, 0x22, 0x22, 0x22, 0xF0, 0x7E, 0x10, 0x44, 0x09, 0x01, 0x40, 0x50, 0x1F, 0x85,
+  0x01, 0x40, 0xD0, 0x24, 0x31, 0xF8, 0x39, 0x27, 0x00, 0x18, 0x1C, 0x0F, 0x06, 0xC3, 0x21, 0x98,
+  0xC6, 0x61, 0x30, 0xD8, 0x3C, 0x0E, 0x06, 0x18, 0x02, 0x00, 0x40, 0x00, 0x1E, 0x18, 0x64, 0x0A,
+  0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x50, 0x26, 0x18, 0x78, 0x03, 0x01, 0x80, 0xC0, 0x00,
+  0x1E, 0x18, 0x64, 0x0A, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x50, 0x26, 0x18, 0x78, 0x0C,
+  0x07, 0x83, 0x30, 0x00, 0x1E, 0x18, 0x64, 0x0A, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x50,
+  0x26, 0x18, 0x78, 0x19, 0x09, 0xC0, 0x00, 0x78, 0x61, 0x90, 0x28, 0x06, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x01, 0x40, 0x98, 0x61, 0xE0, 0x12, 0x00, 0x00, 0x00, 0x78, 0x61, 0x90, 0x28, 0x06, 0x01,
+  0x80, 0x60, 0x18, 0x06, 0x01, 0x40, 0x98, 0x61, 0xE0, 0xC6, 0xD8, 0xE1, 0xC6, 0xC8, 0xC0, 0x80,
+  0x1F, 0x98, 0x64, 0x1E, 0x09, 0x86, 0x61, 0x18, 0x86, 0x61, 0xB0, 0x78, 0x26, 0x19, 0xF8, 0x30,
+  0x0C, 0x03, 0x00, 0x08, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x05, 0x04,
+  0x7C, 0x06, 0x02, 0x02, 0x00, 0x08, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+  0x05, 0x04, 0x7C, 0x08, 0x0E, 0x08, 0x80, 0x08, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x05, 0x04, 0x7C, 0x24, 0x00, 0x00, 0x10, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0,
+  0x60, 0x30, 0x18, 0x0A, 0x08, 0xF8, 0x06, 0x02, 0x02, 0x00, 0x0C, 0x1A, 0x09, 0x8C, 0x44, 0x34,
+  0x0A, 0x02, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x81, 0x03, 0xE4, 0x28, 0x30, 0x60, 0xC2, 0xF9,
+  0x02, 0x04, 0x00, 0x7C, 0xC2, 0x82, 0x86, 0x88, 0x98, 0x8C, 0x86, 0x83, 0x81, 0x81, 0x9E, 0x30,
+  0x30, 0x03, 0xE4, 0x60, 0x40, 0xBF, 0xC3, 0x06, 0x1B, 0xD0, 0x0C, 0x30, 0x03, 0xE4, 0x60, 0x40,
+  0xBF, 0xC3, 0x06, 0x1B, 0xD0, 0x38, 0xC8, 0x03, 0xE4, 0x60, 0x40, 0xBF, 0xC3, 0x06, 0x1B, 0xD0,
+  0x73, 0x38, 0x03, 0xE4, 0x60, 0x40, 0xBF, 0xC3, 0x06, 0x1B, 0xD0, 0x24, 0x00, 0x03, 0xE4, 0x60,
+  0x40, 0xBF, 0xC3, 0x06, 0x1B, 0xD0, 0x18, 0x48, 0x90, 0xC0, 0x0F, 0x91, 0x81, 0x02, 0xFF, 0x0C,
+  0x18, 0x6F, 0x40, 0x7D, 0xE0, 0x38, 0x80, 0x82, 0x04, 0x17, 0xFF, 0xE1, 0x02, 0x08, 0x10, 0xA1,
+  0x78, 0xF8, 0x3D, 0x08, 0x20, 0x82, 0x08, 0x10, 0x3C, 0x41, 0x82, 0x30, 0x60, 0x20, 0x01, 0xC4,
+  0x50, 0x60, 0xFF, 0x81, 0x01, 0x09, 0xF0, 0x0C, 0x30, 0x01, 0xC4, 0x50, 0x60, 0xFF, 0x81, 0x01,
+  0x09, 0xF0, 0x38, 0xD8, 0x01, 0xC4, 0x50, 0x60, 0xFF, 0x81, 0x01, 0x09, 0xF0, 0x24, 0x00, 0x01,
+  0xC6, 0x58, 0x70, 0xFF, 0xC1, 0x81, 0x89, 0xF0, 0x91, 0x55, 0x55, 0x62, 0xAA, 0xAA, 0x26, 0x82,
+  0x42, 0x10, 0x84, 0x21, 0x08, 0x40, 0x88, 0x00, 0x42, 0x10, 0x84, 0x21, 0x08, 0x40, 0x22, 0x3E,
+  0x3C, 0x26, 0x02, 0x3D, 0x43, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x75, 0x38, 0x05, 0xEC, 0x70,
+  0x60, 0xC1, 0x83, 0x06, 0x0C, 0x10, 0x30, 0x18, 0x00, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x42, 0x3C, 0x0C, 0x18, 0x00, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x18, 0x24,
+  0x42, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x72, 0x4E, 0x00, 0x3C, 0x42, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x24, 0x00, 0x00, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x42, 0x3C, 0x18, 0x18, 0x00, 0x00, 0xFF, 0x00, 0x18, 0x18, 0x3F, 0x42, 0x85, 0x8D, 0x99, 0xB1,
+  0xA1, 0xC2, 0xFC, 0x20, 0x20, 0x04, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x1B, 0xD0, 0x0C, 0x30,
+  0x04, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x1B, 0xD0, 0x38, 0xD8, 0x04, 0x18, 0x30, 0x60, 0xC1,
+  0x83, 0x07, 0x1B, 0xD0, 0x24, 0x00, 0x04, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0x1B, 0xD0, 0x0C,
+  0x18, 0x00, 0xC3, 0xC2, 0x42, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x30, 0xE0, 0x81,
+  0x02, 0x05, 0xCC, 0x50, 0x60, 0xC1, 0x83, 0x07, 0x15, 0xC8, 0x10, 0x20, 0x40, 0x24, 0x00, 0x00,
+  0x43, 0x42, 0x62, 0x66, 0x24, 0x24, 0x3C, 0x18, 0x18, 0x18, 0x10, 0x30, 0xE0, 0xCC, 0xF3, 0x30,
+  0x00,
+};
+
+static const pGLYPH FontNoto16_Glyphs[] = {
+  /* offset, width, height, advance, left, top */
+  {    0,  0,  0,  4,  0, 18}, /* ' ' */
+  {    0,  2, 12,  4,  1,  6}, /* '!' */
+  {    3,  4,  4,  7,  1,  6}, /* '"' */
+  {    5, 10, 12, 12,  1,  6}, /* '#' */
+  {   20,  7, 14,  9,  1,  6}, /* '$' */
+  {   33, 12, 12, 14,  1,  6}, /* '%' */
+  {   51, 11, 12, 12,  1,  6}, /* '&' */
+  {   68,  2,  4,  4,  1,  6}, /* '\'' */
+  {   69,  3, 15,  5,  1,  6}, /* '(' */
+  {   75,  3, 15,  5,  1,  6}, /* ')' */
+  {   81,  7,  7,  9,  1,  6}, /* '*' */
+  {   88,  8,  8, 10,  1,  8}, /* '+' */
+  {   96,  2,  4,  4,  1, 16}, /* ',' */
+  {   97,  4,  1,  6,  1, 13}, /* '-' */
+  {   98,  2,  2,  4,  1, 16}, /* '.' */
+  {   99,  6, 12,  6,  0,  6}, /* '/' */
+  {  108,  7, 12,  9,  1,  6}, /* '0' */
+  {  119,  4, 12,  9,  1,  6}, /* '1' */
+  {  125,  8, 12,  9,  1,  6}, /* '2' */
+  {  137,  8, 12,  9,  0,  6}, /* '3' */
+  {  149,  8, 12,  9,  1,  6}, /* '4' */
+  {  161,  7, 12,  9,  1,  6}, /* '5' */
+  {  172,  7, 12,  9,  1,  6}, /* '6' */
+  {  183,  8, 12,  9,  1,  6}, /* '7' */
+  {  195,  7, 12,  9,  1,  6}, /* '8' */
+  {  206,  7, 12,  9,  1,  6}, /* '9' */
+  {  217,  2,  9,  4,  1,  9}, /* ':' */
+  {  220,  3, 11,  4,  0,  9}, /* ';' */
+  {  225,  8,  8,  9,  1,  8}, /* '<' */
+  {  233,  7,  4,  9,  1, 10}, /* '=' */
+  {  237,  8,  8,  9,  1,  8}, /* '>' */
+  {  245,  5, 12,  7,  1,  6}, /* '?' */
+  {  253, 12, 13, 14,  1,  6}, /* '@' */
+  {  273, 10, 12, 10,  0,  6}, /* 'A' */
+  {  288,  8, 12, 11,  2,  6}, /* 'B' */
+  {  300,  8, 12, 10,  1,  6}, /* 'C' */
+  {  312,  9, 12, 12,  2,  6}, /* 'D' */
+  {  326,  6, 12,  9,  2,  6}, /* 'E' */
+  {  335,  6, 12,  8,  2,  6}, /* 'F' */
+  {  344,  9, 12, 11,  1,  6}, /* 'G' */
+  {  358,  9, 12, 13,  2,  6}, /* 'H' */
+  {  372,  4, 12,  6,  1,  6}, /* 'I' */
+  {  378,  4, 15,  3, -2,  6}, /* 'J' */
+  {  386,  8, 12, 10,  2,  6}, /* 'K' */
+  {  398,  6, 12,  8,  2,  6}, /* 'L' */
+  {  407, 11, 12, 15,  2,  6}, /* 'M' */
+  {  424,  9, 12, 13,  2,  6}, /* 'N' */
+  {  438, 10, 12, 12,  1,  6}, /* 'O' */
+  {  453,  7, 12, 10,  2,  6}, /* 'P' */
+  {  464, 10, 15, 12,  1,  6}, /* 'Q' */
+  {  483,  8, 12, 10,  2,  6}, /* 'R' */
+  {  495,  7, 12,  9,  1,  6}, /* 'S' */
+  {  506,  9, 12, 11,  1,  6}, /* 'T' */
+  {  520,  9, 12, 11,  1,  6}, /* 'U' */
+  {  534,  9, 12, 10,  0,  6}, /* 'V' */
+  {  548, 15, 12, 15,  0,  6}, /* 'W' */
+  {  571,  9, 12,  9,  0,  6}, /* 'X' */
+  {  585,  9, 12,  9,  0,  6}, /* 'Y' */
+  {  599,  8, 12, 10,  1,  6}, /* 'Z' */
+  {  611,  3, 14,  5,  1,  6}, /* '[' */
+  {  617,  6, 12,  6,  0,  6}, /* '\\' */
+  {  626,  3, 14,  5,  1,  6}, /* ']' */
+  {  632,  7,  8,  9,  1,  6}, /* '^' */
+  {  639,  7,  1,  7,  0, 20}, /* '_' */
+  {  640,  3,  3,  5,  1,  5}, /* '`' */
+  {  642,  7,  9,  9,  1,  9}, /* 'a' */
+  {  650,  7, 12,  9,  1,  6}, /* 'b' */
+  {  661,  6,  9,  8,  1,  9}, /* 'c' */
+  {  668,  7, 12,  9,  1,  6}, /* 'd' */
+  {  679,  7,  9,  9,  1,  9}, /* 'e' */
+  {  687,  6, 12,  6,  0,  6}, /* 'f' */
+  {  696,  7, 13,  9,  1,  9}, /* 'g' */
+  {  708,  7, 12,  9,  1,  6}, /* 'h' */
+  {  719,  1, 12,  3,  1,  6}, /* 'i' */
+  {  721,  3, 16,  3, -1,  6}, /* 'j' */
+  {  727,  6, 12,  8,  1,  6}, /* 'k' */
+  {  736,  1, 12,  3,  1,  6}, /* 'l' */
+  {  738, 13,  9, 15,  1,  9}, /* 'm' */
+  {  753,  7,  9,  9,  1,  9}, /* 'n' */
+  {  761,  8,  9, 10,  1,  9}, /* 'o' */
+  {  770,  7, 13,  9,  1,  9}, /* 'p' */
+  {  782,  7, 13,  9,  1,  9}, /* 'q' */
+  {  794,  5,  9,  6,  1,  9}, /* 'r' */
+  {  800,  6,  9,  8,  1,  9}, /* 's' */
+  {  807,  5, 11,  6,  0,  7}, /* 't' */
+  {  814,  7,  9,  9,  1,  9}, /* 'u' */
+  {  822,  8,  9,  8,  0,  9}, /* 'v' */
+  {  831, 12,  9, 13,  0,  9}, /* 'w' */
+  {  845,  7,  9,  8,  1,  9}, /* 'x' */
+  {  853,  8, 13,  8,  0,  9}, /* 'y' */
+  {  866,  6,  9,  8,  1,  9}, /* 'z' */
+  {  873,  5, 14,  7,  1,  6}, /* '{' */
+  {  882,  1, 16,  9,  4,  6}, /* '|' */
+  {  884,  6, 14,  7,  1,  6}, /* '}' */
+  {  895,  8,  2, 10,  1, 11}, /* '~' */
+  {  897,  0,  0,  4,  0, 18}, /* U+00A0 */
+  {  897,  2, 12,  4,  1,  9}, /* U+00A1 ¡ */
+  {  900,  6, 12,  9,  1,  6}, /* U+00A2 ¢ */
+  {  909,  8, 12, 10,  1,  6}, /* U+00A3 £ */
+  {  921,  6,  6,  8,  1,  9}, /* U+00A4 ¤ */
+  {  926,  8, 12,  9,  0,  6}, /* U+00A5 ¥ */
+  {  938,  1, 16,  9,  4,  6}, /* U+00A6 ¦ */
+  {  940,  6, 12,  8,  1,  6}, /* U+00A7 § */
+  {  949,  4,  1,  8,  2,  6}, /* U+00A8 ¨ */
+  {  950, 12, 12, 14,  1,  6}, /* U+00A9 © */
+  {  968,  4,  5,  6,  1,  6}, /* U+00AA ª */
+  {  971,  7,  7,  8,  1, 10}, /* U+00AB « */
+  {  978,  7,  4,  9,  1, 12}, /* U+00AC ¬ */
+  {  982,  4,  1,  6,  1, 13}, /* U+00AD ­ */
+  {  983, 12, 12, 14,  1,  6}, /* U+00AE ® */
+  { 1001,  8,  1,  8,  0,  4}, /* U+00AF ¯ */
+  { 1002,  5,  5,  7,  1,  6}, /* U+00B0 ° */
+  { 1006,  8, 10, 10,  1,  8}, /* U+00B1 ± */
+  { 1016,  4,  7,  6,  1,  4}, /* U+00B2 ² */
+  { 1020,  5,  7,  6,  0,  4}, /* U+00B3 ³ */
+  { 1025,  3,  3,  5,  1,  5}, /* U+00B4 ´ */
+  { 1027,  7, 13,  9,  1,  9}, /* U+00B5 µ */
+  { 1039,  9, 15, 11,  0,  6}, /* U+00B6 ¶ */
+  { 1056,  2,  2,  4,  1, 11}, /* U+00B7 · */
+  { 1057,  3,  4,  4,  0, 18}, /* U+00B8 ¸ */
+  { 1059,  3,  7,  6,  1,  4}, /* U+00B9 ¹ */
+  { 1062,  5,  6,  7,  1,  6}, /* U+00BA º */
+  { 1066,  7,  7,  8,  0, 10}, /* U+00BB » */
+  { 1073, 11, 12, 12,  1,  6}, /* U+00BC ¼ */
+  { 1090, 11, 12, 12,  0,  6}, /* U+00BD ½ */
+  { 1107, 12, 12, 12,  0,  6}, /* U+00BE ¾ */
+  { 1125,  6, 12,  8,  1,  9}, /* U+00BF ¿ */
+  { 1134, 10, 16, 10,  0,  2}, /* U+00C0 À */
+  { 1154, 10, 16, 10,  0,  2}, /* U+00C1 Á */
+  { 1174, 10, 16, 10,  0,  2}, /* U+00C2 Â */
+  { 1194, 10, 15, 10,  0,  3}, /* U+00C3 Ã */
+  { 1213, 10, 15, 10,  0,  3}, /* U+00C4 Ä */
+  { 1232, 10, 15, 10,  0,  3}, /* U+00C5 Å */
+  { 1251, 13, 12, 14,  0,  6}, /* U+00C6 Æ */
+  { 1271,  8, 16, 10,  1,  6}, /* U+00C7 Ç */
+  { 1287,  6, 16,  9,  2,  2}, /* U+00C8 È */
+  { 1299,  6, 16,  9,  2,  2}, /* U+00C9 É */
+  { 1311,  6, 16,  9,  2,  2}, /* U+00CA Ê */
+  { 1323,  6, 15,  9,  2,  3}, /* U+00CB Ë */
+  { 1335,  4, 16,  6,  1,  2}, /* U+00CC Ì */
+  { 1343,  4, 16,  6,  1,  2}, /* U+00CD Í */
+  { 1351,  4, 16,  6,  1,  2}, /* U+00CE Î */
+  { 1359,  4, 15,  6,  1,  3}, /* U+00CF Ï */
+  { 1367, 10, 12, 12,  1,  6}, /* U+00D0 Ð */
+  { 1382,  9, 15, 13,  2,  3}, /* U+00D1 Ñ */
+  { 1399, 10, 16, 12,  1,  2}, /* U+00D2 Ò */
+  { 1419, 10, 16, 12,  1,  2}, /* U+00D3 Ó */
+  { 1439, 10, 16, 12,  1,  2}, /* U+00D4 Ô */
+  { 1459, 10, 15, 12,  1,  3}, /* U+00D5 Õ */
+  { 1478, 10, 15, 12,  1,  3}, /* U+00D6 Ö */
+  { 1497,  7,  7,  9,  1,  9}, /* U+00D7 × */
+  { 1504, 10, 12, 12,  1,  6}, /* U+00D8 Ø */
+  { 1519,  9, 16, 11,  1,  2}, /* U+00D9 Ù */
+  { 1537,  9, 16, 11,  1,  2}, /* U+00DA Ú */
+  { 1555,  9, 16, 11,  1,  2}, /* U+00DB Û */
+  { 1573,  9, 15, 11,  1,  3}, /* U+00DC Ü */
+  { 1590,  9, 16,  9,  0,  2}, /* U+00DD Ý */
+  { 1608,  7, 12, 10,  2,  6}, /* U+00DE Þ */
+  { 1619,  8, 12, 10,  1,  6}, /* U+00DF ß */
+  { 1631,  7, 12,  9,  1,  6}, /* U+00E0 à */
+  { 1642,  7, 12,  9,  1,  6}, /* U+00E1 á */
+  { 1653,  7, 12,  9,  1,  6}, /* U+00E2 â */
+  { 1664,  7, 12,  9,  1,  6}, /* U+00E3 ã */
+  { 1675,  7, 12,  9,  1,  6}, /* U+00E4 ä */
+  { 1686,  7, 14,  9,  1,  4}, /* U+00E5 å */
+  { 1699, 13,  9, 15,  1,  9}, /* U+00E6 æ */
+  { 1714,  6, 13,  8,  1,  9}, /* U+00E7 ç */
+  { 1724,  7, 12,  9,  1,  6}, /* U+00E8 è */
+  { 1735,  7, 12,  9,  1,  6}, /* U+00E9 é */
+  { 1746,  7, 12,  9,  1,  6}, /* U+00EA ê */
+  { 1757,  7, 12,  9,  1,  6}, /* U+00EB ë */
+  { 1768,  2, 12,  3,  0,  6}, /* U+00EC ì */
+  { 1771,  2, 12,  3,  1,  6}, /* U+00ED í */
+  { 1774,  5, 12,  3, -1,  6}, /* U+00EE î */
+  { 1782,  5, 12,  5,  0,  6}, /* U+00EF ï */
+  { 1790,  8, 13, 10,  1,  5}, /* U+00F0 ð */
+  { 1803,  7, 12,  9,  1,  6}, /* U+00F1 ñ */
+  { 1814,  8, 12, 10,  1,  6}, /* U+00F2 ò */
+  { 1826,  8, 12, 10,  1,  6}, /* U+00F3 ó */
+  { 1838,  8, 12, 10,  1,  6}, /* U+00F4 ô */
+  { 1850,  8, 12, 10,  1,  6}, /* U+00F5 õ */
+  { 1862,  8, 12, 10,  1,  6}, /* U+00F6 ö */
+  { 1874,  8,  8, 10,  1,  8}, /* U+00F7 ÷ */
+  { 1882,  8,  9, 10,  1,  9}, /* U+00F8 ø */
+  { 1891,  7, 12,  9,  1,  6}, /* U+00F9 ù */
+  { 1902,  7, 12,  9,  1,  6}, /* U+00FA ú */
+  { 1913,  7, 12,  9,  1,  6}, /* U+00FB û */
+  { 1924,  7, 12,  9,  1,  6}, /* U+00FC ü */
+  { 1935,  8, 16,  8,  0,  6}, /* U+00FD ý */
+  { 1951,  7, 16,  9,  1,  6}, /* U+00FE þ */
+  { 1965,  8, 16,  8,  0,  6}, /* U+00FF ÿ */
+  { 1981, 10,  2, 12,  1, 16}, /* U+2026 … */
+};
+
+static const pRANGE FontNoto16_Ranges[] = {
+  {0x0020,  95,   0},
+  {0x00A0,  96,  95},
+  {0x2026,   1, 191},
+};
+
+static const pKERN FontNoto16_Kerning[] = {
+  {  2,  33, -1}, /* '"' 'A' */
+  {  2,  65, -1}, /* '"' 'a' */
+  {  2,  67, -1}, /* '"' 'c' */
+  {  2,  68, -1}, /* '"' 'd' */
+  {  2,  69, -1}, /* '"' 'e' */
+  {  2,  79, -1}, /* '"' 'o' */
+  {  2,  81, -1}, /* '"' 'q' */
+  {  2, 127, -1}, /* '"' U+00C0 À */
+  {  2, 128, -1}, /* '"' U+00C1 Á */
+  {  2, 129, -1}, /* '"' U+00C2 Â */
+  {  2, 130, -1}, /* '"' U+00C3 Ã */
+  {  2, 131, -1}, /* '"' U+00C4 Ä */
+  {  2, 132, -1}, /* '"' U+00C5 Å */
+  {  2, 133, -1}, /* '"' U+00C6 Æ */
+  {  2, 159, -1}, /* '"' U+00E0 à */
+  {  2, 160, -1}, /* '"' U+00E1 á */
+  {  2, 161, -1}, /* '"' U+00E2 â */
+  {  2, 162, -1}, /* '"' U+00E3 ã */
+  {  2, 163, -1}, /* '"' U+00E4 ä */
+  {  2, 164, -1}, /* '"' U+00E5 å */
+  {  2, 165, -1}, /* '"' U+00E6 æ */
+  {  2, 166, -1}, /* '"' U+00E7 ç */
+  {  2, 167, -1}, /* '"' U+00E8 è */
+  {  2, 168, -1}, /* '"' U+00E9 é */
+  {  2, 169, -1}, /* '"' U+00EA ê */
+  {  2, 170, -1}, /* '"' U+00EB ë */
+  {  2, 177, -1}, /* '"' U+00F2 ò */
+  {  2, 178, -1}, /* '"' U+00F3 ó */
+  {  2, 179, -1}, /* '"' U+00F4 ô */
+  {  2, 180, -1}, /* '"' U+00F5 õ */
+  {  2, 181, -1}, /* '"' U+00F6 ö */
+  {  2, 183, -1}, /* '"' U+00F8 ø */
+  {  6,  52, -1}, /* '&' 'T' */
+  {  7,  33, -1}, /* '\'' 'A' */
+  {  7,  65, -1}, /* '\'' 'a' */
+  {  7,  67, -1}, /* '\'' 'c' */
+  {  7,  68, -1}, /* '\'' 'd' */
+  {  7,  69, -1}, /* '\'' 'e' */
+  {  7,  79, -1}, /* '\'' 'o' */
+  {  7,  81, -1}, /* '\'' 'q' */
+  {  7, 127, -1}, /* '\'' U+00C0 À */
+  {  7, 128, -1}, /* '\'' U+00C1 Á */
+  {  7, 129, -1}, /* '\'' U+00C2 Â */
+  {  7, 130, -1}, /* '\'' U+00C3 Ã */
+  {  7, 131, -1}, /* '\'' U+00C4 Ä */
+  {  7, 132, -1}, /* '\'' U+00C5 Å */
+  {  7, 133, -1}, /* '\'' U+00C6 Æ */
+  {  7, 159, -1}, /* '\'' U+00E0 à */
+  {  7, 160, -1}, /* '\'' U+00E1 á */
+  {  7, 161, -1}, /* '\'' U+00E2 â */
+  {  7, 162, -1}, /* '\'' U+00E3 ã */
+  {  7, 163, -1}, /* '\'' U+00E4 ä */
+  {  7, 164, -1}, /* '\'' U+00E5 å */
+  {  7, 165, -1}, /* '\'' U+00E6 æ */
+  {  7, 166, -1}, /* '\'' U+00E7 ç */
+  {  7, 167, -1}, /* '\'' U+00E8 è */
+  {  7, 168, -1}, /* '\'' U+00E9 é */
+  {  7, 169, -1}, /* '\'' U+00EA ê */
+  {  7, 170, -1}, /* '\'' U+00EB ë */
+  {  7, 177, -1}, /* '\'' U+00F2 ò */
+  {  7, 178, -1}, /* '\'' U+00F3 ó */
+  {  7, 179, -1}, /* '\'' U+00F4 ô */
+  {  7, 180, -1}, /* '\'' U+00F5 õ */
+  {  7, 181, -1}, /* '\'' U+00F6 ö */
+  {  7, 183, -1}, /* '\'' U+00F8 ø */
+  {  8,  42,  1}, /* '(' 'J' */
+  {  8,  74,  1}, /* '(' 'j' */
+  { 12,  35, -1}, /* ',' 'C' */
+  { 12,  39, -1}, /* ',' 'G' */
+  { 12,  47, -1}, /* ',' 'O' */
+  { 12,  49, -1}, /* ',' 'Q' */
+  { 12,  52, -1}, /* ',' 'T' */
+  { 12,  54, -1}, /* ',' 'V' */
+  { 12,  55, -1}, /* ',' 'W' */
+  { 12,  57, -1}, /* ',' 'Y' */
+  { 12, 134, -1}, /* ',' U+00C7 Ç */
+  { 12, 145, -1}, /* ',' U+00D2 Ò */
+  { 12, 146, -1}, /* ',' U+00D3 Ó */
+  { 12, 147, -1}, /* ',' U+00D4 Ô */
+  { 12, 148, -1}, /* ',' U+00D5 Õ */
+  { 12, 149, -1}, /* ',' U+00D6 Ö */
+  { 12, 151, -1}, /* ',' U+00D8 Ø */
+  { 12, 156, -1}, /* ',' U+00DD Ý */
+  { 13,  52, -1}, /* '-' 'T' */
+  { 14,  35, -1}, /* '.' 'C' */
+  { 14,  39, -1}, /* '.' 'G' */
+  { 14,  47, -1}, /* '.' 'O' */
+  { 14,  49, -1}, /* '.' 'Q' */
+  { 14,  52, -1}, /* '.' 'T' */
+  { 14,  54, -1}, /* '.' 'V' */
+  { 14,  55, -1}, /* '.' 'W' */
+  { 14,  57, -1}, /* '.' 'Y' */
+  { 14, 134, -1}, /* '.' U+00C7 Ç */
+  { 14, 145, -1}, /* '.' U+00D2 Ò */
+  { 14, 146, -1}, /* '.' U+00D3 Ó */
+  { 14, 147, -1}, /* '.' U+00D4 Ô */
+  { 14, 148, -1}, /* '.' U+00D5 Õ */
+  { 14, 149, -1}, /* '.' U+00D6 Ö */
+  { 14, 151, -1}, /* '.' U+00D8 Ø */
+  { 14, 156, -1}, /* '.' U+00DD Ý */
+  { 33,   2, -1}, /* 'A' '"' */
+  { 33,   7, -1}, /* 'A' '\'' */
+  { 33,  42,  1}, /* 'A' 'J' */
+  { 33,  52, -1}, /* 'A' 'T' */
+  { 33,  54, -1}, /* 'A' 'V' */
+  { 33,  55, -1}, /* 'A' 'W' */
+  { 33,  57, -1}, /* 'A' 'Y' */
+  { 33, 156, -1}, /* 'A' U+00DD Ý */
+  { 36,  12, -1}, /* 'D' ',' */
+  { 36,  14, -1}, /* 'D' '.' */
+  { 36, 191, -1}, /* 'D' U+2026 … */
+  { 37,  42,  1}, /* 'E' 'J' */
+  { 38,  12, -1}, /* 'F' ',' */
+  { 38,  14, -1}, /* 'F' '.' */
+  { 38, 191, -1}, /* 'F' U+2026 … */
+  { 44,   2, -1}, /* 'L' '"' */
+  { 44,   7, -1}, /* 'L' '\'' */
+  { 47,  12, -1}, /* 'O' ',' */
+  { 47,  14, -1}, /* 'O' '.' */
+  { 47, 191, -1}, /* 'O' U+2026 … */
+  { 48,  12, -2}, /* 'P' ',' */
+  { 48,  14, -2}, /* 'P' '.' */
+  { 48,  33, -1}, /* 'P' 'A' */
+  { 48, 127, -1}, /* 'P' U+00C0 À */
+  { 48, 128, -1}, /* 'P' U+00C1 Á */
+  { 48, 129, -1}, /* 'P' U+00C2 Â */
+  { 48, 130, -1}, /* 'P' U+00C3 Ã */
+  { 48, 131, -1}, /* 'P' U+00C4 Ä */
+  { 48, 132, -1}, /* 'P' U+00C5 Å */
+  { 48, 191, -2}, /* 'P' U+2026 … */
+  { 49,  12, -1}, /* 'Q' ',' */
+  { 49,  14, -1}, /* 'Q' '.' */
+  { 49, 191, -1}, /* 'Q' U+2026 … */
+  { 52,  12, -1}, /* 'T' ',' */
+  { 52,  13, -1}, /* 'T' '-' */
+  { 52,  14, -1}, /* 'T' '.' */
+  { 52,  33, -1}, /* 'T' 'A' */
+  { 52,  65, -1}, /* 'T' 'a' */
+  { 52,  67, -1}, /* 'T' 'c' */
+  { 52,  68, -1}, /* 'T' 'd' */
+  { 52,  69, -1}, /* 'T' 'e' */
+  { 52,  71, -1}, /* 'T' 'g' */
+  { 52,  77, -1}, /* 'T' 'm' */
+  { 52,  78, -1}, /* 'T' 'n' */
+  { 52,  79, -1}, /* 'T' 'o' */
+  { 52,  80, -1}, /* 'T' 'p' */
+  { 52,  81, -1}, /* 'T' 'q' */
+  { 52,  82, -1}, /* 'T' 'r' */
+  { 52,  83, -1}, /* 'T' 's' */
+  { 52,  85, -1}, /* 'T' 'u' */
+  { 52,  90, -1}, /* 'T' 'z' */
+  { 52, 106, -1}, /* 'T' U+00AB « */
+  { 52, 127, -1}, /* 'T' U+00C0 À */
+  { 52, 128, -1}, /* 'T' U+00C1 Á */
+  { 52, 129, -1}, /* 'T' U+00C2 Â */
+  { 52, 130, -1}, /* 'T' U+00C3 Ã */
+  { 52, 131, -1}, /* 'T' U+00C4 Ä */
+  { 52, 132, -1}, /* 'T' U+00C5 Å */
+  { 52, 159, -1}, /* 'T' U+00E0 à */
+  { 52, 160, -1}, /* 'T' U+00E1 á */
+  { 52, 161, -1}, /* 'T' U+00E2 â */
+  { 52, 162, -1}, /* 'T' U+00E3 ã */
+  { 52, 163, -1}, /* 'T' U+00E4 ä */
+  { 52, 164, -1}, /* 'T' U+00E5 å */
+  { 52, 165, -1}, /* 'T' U+00E6 æ */
+  { 52, 166, -1}, /* 'T' U+00E7 ç */
+  { 52, 167, -1}, /* 'T' U+00E8 è */
+  { 52, 168, -1}, /* 'T' U+00E9 é */
+  { 52, 169, -1}, /* 'T' U+00EA ê */
+  { 52, 170, -1}, /* 'T' U+00EB ë */
+  { 52, 177, -1}, /* 'T' U+00F2 ò */
+  { 52, 178, -1}, /* 'T' U+00F3 ó */
+  { 52, 179, -1}, /* 'T' U+00F4 ô */
+  { 52, 180, -1}, /* 'T' U+00F5 õ */
+  { 52, 181, -1}, /* 'T' U+00F6 ö */
+  { 52, 183, -1}, /* 'T' U+00F8 ø */
+  { 52, 184, -1}, /* 'T' U+00F9 ù */
+  { 52, 185, -1}, /* 'T' U+00FA ú */
+  { 52, 186, -1}, /* 'T' U+00FB û */
+  { 52, 187, -1}, /* 'T' U+00FC ü */
+  { 52, 191, -1}, /* 'T' U+2026 … */
+  { 54,  12, -1}, /* 'V' ',' */
+  { 54,  14, -1}, /* 'V' '.' */
+  { 54,  33, -1}, /* 'V' 'A' */
+  { 54, 127, -1}, /* 'V' U+00C0 À */
+  { 54, 128, -1}, /* 'V' U+00C1 Á */
+  { 54, 129, -1}, /* 'V' U+00C2 Â */
+  { 54, 130, -1}, /* 'V' U+00C3 Ã */
+  { 54, 131, -1}, /* 'V' U+00C4 Ä */
+  { 54, 132, -1}, /* 'V' U+00C5 Å */
+  { 54, 191, -1}, /* 'V' U+2026 … */
+  { 55,  12, -1}, /* 'W' ',' */
+  { 55,  14, -1}, /* 'W' '.' */
+  { 55,  33, -1}, /* 'W' 'A' */
+  { 55, 127, -1}, /* 'W' U+00C0 À */
+  { 55, 128, -1}, /* 'W' U+00C1 Á */
+  { 55, 129, -1}, /* 'W' U+00C2 Â */
+  { 55, 130, -1}, /* 'W' U+00C3 Ã */
+  { 55, 131, -1}, /* 'W' U+00C4 Ä */
+  { 55, 132, -1}, /* 'W' U+00C5 Å */
+  { 55, 191, -1}, /* 'W' U+2026 … */
+  { 57,  12, -1}, /* 'Y' ',' */
+  { 57,  14, -1}, /* 'Y' '.' */
+  { 57,  33, -1}, /* 'Y' 'A' */
+  { 57,  65, -1}, /* 'Y' 'a' */
+  { 57,  67, -1}, /* 'Y' 'c' */
+  { 57,  68, -1}, /* 'Y' 'd' */
+  { 57,  69, -1}, /* 'Y' 'e' */
+  { 57,  71, -1}, /* 'Y' 'g' */
+  { 57,  79, -1}, /* 'Y' 'o' */
+  { 57,  81, -1}, /* 'Y' 'q' */
+  { 57,  83, -1}, /* 'Y' 's' */
+  { 57, 106, -1}, /* 'Y' U+00AB « */
+  { 57, 127, -1}, /* 'Y' U+00C0 À */
+  { 57, 128, -1}, /* 'Y' U+00C1 Á */
+  { 57, 129, -1}, /* 'Y' U+00C2 Â */
+  { 57, 130, -1}, /* 'Y' U+00C3 Ã */
+  { 57, 131, -1}, /* 'Y' U+00C4 Ä */
+  { 57, 132, -1}, /* 'Y' U+00C5 Å */
+  { 57, 159, -1}, /* 'Y' U+00E0 à */
+  { 57, 160, -1}, /* 'Y' U+00E1 á */
+  { 57, 161, -1}, /* 'Y' U+00E2 â */
+  { 57, 162, -1}, /* 'Y' U+00E3 ã */
+  { 57, 163, -1}, /* 'Y' U+00E4 ä */
+  { 57, 164, -1}, /* 'Y' U+00E5 å */
+  { 57, 165, -1}, /* 'Y' U+00E6 æ */
+  { 57, 166, -1}, /* 'Y' U+00E7 ç */
+  { 57, 167, -1}, /* 'Y' U+00E8 è */
+  { 57, 168, -1}, /* 'Y' U+00E9 é */
+  { 57, 169, -1}, /* 'Y' U+00EA ê */
+  { 57, 170, -1}, /* 'Y' U+00EB ë */
+  { 57, 177, -1}, /* 'Y' U+00F2 ò */
+  { 57, 178, -1}, /* 'Y' U+00F3 ó */
+  { 57, 179, -1}, /* 'Y' U+00F4 ô */
+  { 57, 180, -1}, /* 'Y' U+00F5 õ */
+  { 57, 181, -1}, /* 'Y' U+00F6 ö */
+  { 57, 183, -1}, /* 'Y' U+00F8 ø */
+  { 57, 191, -1}, /* 'Y' U+2026 … */
+  { 59,  42,  1}, /* '[' 'J' */
+  { 59,  74,  1}, /* '[' 'j' */
+  { 63,  42,  2}, /* '_' 'J' */
+  { 70,   2,  1}, /* 'f' '"' */
+  { 70,   7,  1}, /* 'f' '\'' */
+  { 70,   9,  1}, /* 'f' ')' */
+  { 70,  61,  1}, /* 'f' ']' */
+  { 70,  93,  1}, /* 'f' '}' */
+  { 82,   2,  1}, /* 'r' '"' */
+  { 82,   7,  1}, /* 'r' '\'' */
+  { 82,  12, -3}, /* 'r' ',' */
+  { 82,  14, -3}, /* 'r' '.' */
+  { 82, 191, -3}, /* 'r' U+2026 … */
+  { 86,   2,  1}, /* 'v' '"' */
+  { 86,   7,  1}, /* 'v' '\'' */
+  { 86,  12, -1}, /* 'v' ',' */
+  { 86,  14, -1}, /* 'v' '.' */
+  { 86, 191, -1}, /* 'v' U+2026 … */
+  { 87,   2,  1}, /* 'w' '"' */
+  { 87,   7,  1}, /* 'w' '\'' */
+  { 87,  12, -1}, /* 'w' ',' */
+  { 87,  14, -1}, /* 'w' '.' */
+  { 87, 191, -1}, /* 'w' U+2026 … */
+  { 89,   2,  1}, /* 'y' '"' */
+  { 89,   7,  1}, /* 'y' '\'' */
+  { 89,  12, -1}, /* 'y' ',' */
+  { 89,  14, -1}, /* 'y' '.' */
+  { 89, 191, -1}, /* 'y' U+2026 … */
+  { 91,  42,  1}, /* '{' 'J' */
+  { 91,  74,  1}, /* '{' 'j' */
+  { 96,  42,  1}, /* U+00A1 ¡ 'J' */
+  {122,  52, -1}, /* U+00BB » 'T' */
+  {122,  57, -1}, /* U+00BB » 'Y' */
+  {122, 156, -1}, /* U+00BB » U+00DD Ý */
+  {126,  42,  2}, /* U+00BF ¿ 'J' */
+  {126,  52, -1}, /* U+00BF ¿ 'T' */
+  {126,  57, -1}, /* U+00BF ¿ 'Y' */
+  {126, 156, -1}, /* U+00BF ¿ U+00DD Ý */
+  {127,   2, -1}, /* U+00C0 À '"' */
+  {127,   7, -1}, /* U+00C0 À '\'' */
+  {127,  42,  1}, /* U+00C0 À 'J' */
+  {127,  52, -1}, /* U+00C0 À 'T' */
+  {127,  54, -1}, /* U+00C0 À 'V' */
+  {127,  55, -1}, /* U+00C0 À 'W' */
+  {127,  57, -1}, /* U+00C0 À 'Y' */
+  {127, 156, -1}, /* U+00C0 À U+00DD Ý */
+  {128,   2, -1}, /* U+00C1 Á '"' */
+  {128,   7, -1}, /* U+00C1 Á '\'' */
+  {128,  42,  1}, /* U+00C1 Á 'J' */
+  {128,  52, -1}, /* U+00C1 Á 'T' */
+  {128,  54, -1}, /* U+00C1 Á 'V' */
+  {128,  55, -1}, /* U+00C1 Á 'W' */
+  {128,  57, -1}, /* U+00C1 Á 'Y' */
+  {128, 156, -1}, /* U+00C1 Á U+00DD Ý */
+  {129,   2, -1}, /* U+00C2 Â '"' */
+  {129,   7, -1}, /* U+00C2 Â '\'' */
+  {129,  42,  1}, /* U+00C2 Â 'J' */
+  {129,  52, -1}, /* U+00C2 Â 'T' */
+  {129,  54, -1}, /* U+00C2 Â 'V' */
+  {129,  55, -1}, /* U+00C2 Â 'W' */
+  {129,  57, -1}, /* U+00C2 Â 'Y' */
+  {129, 156, -1}, /* U+00C2 Â U+00DD Ý */
+  {130,   2, -1}, /* U+00C3 Ã '"' */
+  {130,   7, -1}, /* U+00C3 Ã '\'' */
+  {130,  42,  1}, /* U+00C3 Ã 'J' */
+  {130,  52, -1}, /* U+00C3 Ã 'T' */
+  {130,  54, -1}, /* U+00C3 Ã 'V' */
+  {130,  55, -1}, /* U+00C3 Ã 'W' */
+  {130,  57, -1}, /* U+00C3 Ã 'Y' */
+  {130, 156, -1}, /* U+00C3 Ã U+00DD Ý */
+  {131,   2, -1}, /* U+00C4 Ä '"' */
+  {131,   7, -1}, /* U+00C4 Ä '\'' */
+  {131,  42,  1}, /* U+00C4 Ä 'J' */
+  {131,  52, -1}, /* U+00C4 Ä 'T' */
+  {131,  54, -1}, /* U+00C4 Ä 'V' */
+  {131,  55, -1}, /* U+00C4 Ä 'W' */
+  {131,  57, -1}, /* U+00C4 Ä 'Y' */
+  {131, 156, -1}, /* U+00C4 Ä U+00DD Ý */
+  {132,   2, -1}, /* U+00C5 Å '"' */
+  {132,   7, -1}, /* U+00C5 Å '\'' */
+  {132,  42,  1}, /* U+00C5 Å 'J' */
+  {132,  52, -1}, /* U+00C5 Å 'T' */
+  {132,  54, -1}, /* U+00C5 Å 'V' */
+  {132,  55, -1}, /* U+00C5 Å 'W' */
+  {132,  57, -1}, /* U+00C5 Å 'Y' */
+  {132, 156, -1}, /* U+00C5 Å U+00DD Ý */
+  {133,  42,  1}, /* U+00C6 Æ 'J' */
+  {135,  42,  1}, /* U+00C8 È 'J' */
+  {136,  42,  1}, /* U+00C9 É 'J' */
+  {137,  42,  1}, /* U+00CA Ê 'J' */
+  {138,  42,  1}, /* U+00CB Ë 'J' */
+  {143,  12, -1}, /* U+00D0 Ð ',' */
+  {143,  14, -1}, /* U+00D0 Ð '.' */
+  {143, 191, -1}, /* U+00D0 Ð U+2026 … */
+  {145,  12, -1}, /* U+00D2 Ò ',' */
+  {145,  14, -1}, /* U+00D2 Ò '.' */
+  {145, 191, -1}, /* U+00D2 Ò U+2026 … */
+  {146,  12, -1}, /* U+00D3 Ó ',' */
+  {146,  14, -1}, /* U+00D3 Ó '.' */
+  {146, 191, -1}, /* U+00D3 Ó U+2026 … */
+  {147,  12, -1}, /* U+00D4 Ô ',' */
+  {147,  14, -1}, /* U+00D4 Ô '.' */
+  {147, 191, -1}, /* U+00D4 Ô U+2026 … */
+  {148,  12, -1}, /* U+00D5 Õ ',' */
+  {148,  14, -1}, /* U+00D5 Õ '.' */
+  {148, 191, -1}, /* U+00D5 Õ U+2026 … */
+  {149,  12, -1}, /* U+00D6 Ö ',' */
+  {149,  14, -1}, /* U+00D6 Ö '.' */
+  {149, 191, -1}, /* U+00D6 Ö U+2026 … */
+  {151,  12, -1}, /* U+00D8 Ø ',' */
+  {151,  14, -1}, /* U+00D8 Ø '.' */
+  {151, 191, -1}, /* U+00D8 Ø U+2026 … */
+  {156,  12, -1}, /* U+00DD Ý ',' */
+  {156,  14, -1}, /* U+00DD Ý '.' */
+  {156,  33, -1}, /* U+00DD Ý 'A' */
+  {156,  65, -1}, /* U+00DD Ý 'a' */
+  {156,  67, -1}, /* U+00DD Ý 'c' */
+  {156,  68, -1}, /* U+00DD Ý 'd' */
+  {156,  69, -1}, /* U+00DD Ý 'e' */
+  {156,  71, -1}, /* U+00DD Ý 'g' */
+  {156,  79, -1}, /* U+00DD Ý 'o' */
+  {156,  81, -1}, /* U+00DD Ý 'q' */
+  {156,  83, -1}, /* U+00DD Ý 's' */
+  {156, 106, -1}, /* U+00DD Ý U+00AB « */
+  {156, 127, -1}, /* U+00DD Ý U+00C0 À */
+  {156, 128, -1}, /* U+00DD Ý U+00C1 Á */
+  {156, 129, -1}, /* U+00DD Ý U+00C2 Â */
+  {156, 130, -1}, /* U+00DD Ý U+00C3 Ã */
+  {156, 131, -1}, /* U+00DD Ý U+00C4 Ä */
+  {156, 132, -1}, /* U+00DD Ý U+00C5 Å */
+  {156, 159, -1}, /* U+00DD Ý U+00E0 à */
+  {156, 160, -1}, /* U+00DD Ý U+00E1 á */
+  {156, 161, -1}, /* U+00DD Ý U+00E2 â */
+  {156, 162, -1}, /* U+00DD Ý U+00E3 ã */
+  {156, 163, -1}, /* U+00DD Ý U+00E4 ä */
+  {156, 164, -1}, /* U+00DD Ý U+00E5 å */
+  {156, 165, -1}, /* U+00DD Ý U+00E6 æ */
+  {156, 166, -1}, /* U+00DD Ý U+00E7 ç */
+  {156, 167, -1}, /* U+00DD Ý U+00E8 è */
+  {156, 168, -1}, /* U+00DD Ý U+00E9 é */
+  {156, 169, -1}, /* U+00DD Ý U+00EA ê */
+  {156, 170, -1}, /* U+00DD Ý U+00EB ë */
+  {156, 177, -1}, /* U+00DD Ý U+00F2 ò */
+  {156, 178, -1}, /* U+00DD Ý U+00F3 ó */
+  {156, 179, -1}, /* U+00DD Ý U+00F4 ô */
+  {156, 180, -1}, /* U+00DD Ý U+00F5 õ */
+  {156, 181, -1}, /* U+00DD Ý U+00F6 ö */
+  {156, 183, -1}, /* U+00DD Ý U+00F8 ø */
+  {156, 191, -1}, /* U+00DD Ý U+2026 … */
+  {157,  12, -2}, /* U+00DE Þ ',' */
+  {157,  14, -2}, /* U+00DE Þ '.' */
+  {157,  33, -1}, /* U+00DE Þ 'A' */
+  {157, 127, -1}, /* U+00DE Þ U+00C0 À */
+  {157, 128, -1}, /* U+00DE Þ U+00C1 Á */
+  {157, 129, -1}, /* U+00DE Þ U+00C2 Â */
+  {157, 130, -1}, /* U+00DE Þ U+00C3 Ã */
+  {157, 131, -1}, /* U+00DE Þ U+00C4 Ä */
+  {157, 132, -1}, /* U+00DE Þ U+00C5 Å */
+  {157, 191, -2}, /* U+00DE Þ U+2026 … */
+  {173,   9,  1}, /* U+00EE î ')' */
+  {173,  61,  1}, /* U+00EE î ']' */
+  {173,  93,  1}, /* U+00EE î '}' */
+  {174,   9,  1}, /* U+00EF ï ')' */
+  {174,  61,  1}, /* U+00EF ï ']' */
+  {174,  93,  1}, /* U+00EF ï '}' */
+  {188,   2,  1}, /* U+00FD ý '"' */
+  {188,   7,  1}, /* U+00FD ý '\'' */
+  {188,  12, -1}, /* U+00FD ý ',' */
+  {188,  14, -1}, /* U+00FD ý '.' */
+  {188, 191, -1}, /* U+00FD ý U+2026 … */
+  {190,   2,  1}, /* U+00FF ÿ '"' */
+  {190,   7,  1}, /* U+00FF ÿ '\'' */
+  {190,  12, -1}, /* U+00FF ÿ ',' */
+  {190,  14, -1}, /* U+00FF ÿ '.' */
+  {190, 191, -1}, /* U+00FF ÿ U+2026 … */
+};
+
+pFONT FontNoto16 = {
+  FontNoto16_Bitmap,
+  FontNoto16_Glyphs,
+  FontNoto16_Ranges,
+  sizeof(FontNoto16_Ranges) / sizeof(pRANGE),
+  FontNoto16_Kerning,
+  sizeof(FontNoto16_Kerning) / sizeof(pKERN),
+  22, /* Height */
+  18, /* Ascent */
+  0, /* not compressed */
+};
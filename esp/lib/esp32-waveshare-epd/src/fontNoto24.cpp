@@ -0,0 +1,891 @@
+/* Generated by font-pack.py from NotoSans.ttf at 24 px, do not edit */
+#include "fonts.h"
+
+static const uint8_t FontNoto24_Bitmap[] = {
+  0xCA, 0xFD, 0x28, 0xCA, 0xCA, 0x57, 0x7B, 0x00, 0x99, 0xDE, 0x08, 0x7C, 0x10, 0x9C, 0x58, 0xB0,
+  0xC5, 0x8B, 0x25, 0x0F, 0x25, 0xD8, 0xC5, 0x8B, 0x0C, 0x58, 0x6C, 0xB9, 0xAE, 0xF2, 0x8B, 0xF3,
+  0x96, 0xA0, 0x58, 0x82, 0x9B, 0xAE, 0x4B, 0xA3, 0x22, 0x95, 0xA4, 0xBB, 0x65, 0x80, 0xC5, 0xA6,
+  0xAB, 0xE6, 0x59, 0x6A, 0x40, 0x6A, 0x00, 0x40, 0x6E, 0x1E, 0x81, 0xE8, 0x06, 0xA0, 0x02, 0x04,
+  0x10, 0x00, 0x41, 0x02, 0xC6, 0xE4, 0xEE, 0x72, 0x73, 0x0F, 0x88, 0x20, 0x61, 0x22, 0x00, 0x8D,
+  0xC0, 0x85, 0xC1, 0x07, 0xF5, 0x26, 0x66, 0x4B, 0x82, 0x66, 0x6B, 0xD0, 0x99, 0xE2, 0x32, 0x06,
+  0x48, 0x58, 0xAD, 0x10, 0xC2, 0x42, 0x66, 0x43, 0x86, 0x20, 0xCA, 0xB1, 0x00, 0x72, 0x0A, 0x0D,
+  0x03, 0xEC, 0x1B, 0x05, 0xC0, 0xCA, 0x61, 0x70, 0xD8, 0x3E, 0xC1, 0xA0, 0x50, 0x20, 0x8C, 0xBB,
+  0x54, 0x33, 0x1A, 0xB2, 0xC8, 0xD7, 0xAC, 0x04, 0xA5, 0x40, 0x8D, 0x30, 0x9B, 0xDF, 0x8B, 0xF2,
+  0xDF, 0x60, 0x31, 0xAE, 0x12, 0xCB, 0xA0, 0xCB, 0x28, 0xAC, 0xBB, 0x70, 0xF1, 0x0D, 0xD8, 0x6E,
+  0x1E, 0x21, 0xBA, 0xE0, 0x7C, 0x91, 0x81, 0x83, 0x0D, 0x42, 0x43, 0x8F, 0x20, 0x90, 0xD4, 0x18,
+  0x31, 0x81, 0x00, 0x89, 0x4D, 0x04, 0x73, 0x71, 0x70, 0x5D, 0x71, 0xE0, 0x12, 0x6B, 0xBB, 0x35,
+  0x59, 0x99, 0x28, 0x94, 0x4A, 0x26, 0x6B, 0x05, 0x82, 0xC5, 0xE8, 0x5E, 0x40, 0xE0, 0x74, 0x87,
+  0xAB, 0x04, 0x8D, 0x29, 0xF3, 0x01, 0x80, 0xFD, 0x86, 0xC8, 0x05, 0xC0, 0x80, 0xBD, 0x86, 0x8D,
+  0x98, 0x68, 0x1E, 0x01, 0x98, 0x78, 0x06, 0x61, 0xAF, 0x57, 0xF1, 0x67, 0xF5, 0x3F, 0x47, 0x9F,
+  0xFD, 0xC8, 0xE9, 0x5C, 0x97, 0x7D, 0xC6, 0x48, 0x03, 0x81, 0x00, 0x9E, 0x47, 0x8C, 0x2C, 0x19,
+  0xAE, 0xDB, 0x92, 0x30, 0xA0, 0xD2, 0x90, 0xF5, 0x0E, 0x60, 0x03, 0x48, 0xC2, 0x00, 0xCB, 0xFF,
+  0xC0, 0x77, 0x35, 0x77, 0x07, 0x70, 0x77, 0x35, 0x77, 0x07, 0x72, 0xE0, 0x7D, 0x81, 0xA1, 0x04,
+  0x07, 0x92, 0x0C, 0x88, 0x88, 0xA4, 0xDA, 0x52, 0x44, 0x8A, 0x12, 0xFF, 0xA0, 0x90, 0x3F, 0x00,
+  0x7C, 0x88, 0xC1, 0x26, 0x00, 0x4B, 0x57, 0x62, 0x08, 0x40, 0xD1, 0x1D, 0xF0, 0x0E, 0xE0, 0xB0,
+  0x3F, 0x18, 0xCB, 0x2B, 0x3B, 0xB2, 0x80, 0x33, 0x3C, 0xF2, 0xC6, 0xB8, 0x48, 0xCF, 0x2D, 0x24,
+  0xCA, 0x89, 0x51, 0x2A, 0x4A, 0xC2, 0xF8, 0x65, 0xE5, 0x5E, 0x59, 0x6C, 0x40, 0xCB, 0xFB, 0xEB,
+  0xFC, 0xCA, 0xD6, 0xBC, 0xAB, 0xE1, 0x67, 0x16, 0x71, 0x5A, 0x49, 0x94, 0xF0, 0xC7, 0x2A, 0xF5,
+  0xC0, 0xCB, 0xC8, 0xD0, 0x50, 0x1D, 0x56, 0x24, 0x12, 0x09, 0x04, 0xB3, 0x95, 0xCF, 0x3C, 0x00,
+  0xB7, 0x99, 0xFE, 0x2A, 0x15, 0x42, 0x03, 0x00, 0x81, 0xF7, 0x51, 0x92, 0x20, 0x83, 0x8F, 0x88,
+  0x48, 0x2B, 0x61, 0x8B, 0x80, 0x46, 0x2D, 0xF1, 0x0E, 0x82, 0xAA, 0xF1, 0xD1, 0x20, 0xAC, 0xEC,
+  0xC0, 0x76, 0x0B, 0x87, 0x7A, 0x92, 0xC3, 0x7E, 0x24, 0x0F, 0x39, 0x02, 0x0F, 0xA0, 0x86, 0xA0,
+  0xCB, 0xDA, 0xE1, 0x67, 0x0F, 0xFD, 0x07, 0xEC, 0x7E, 0xCE, 0x1F, 0xB3, 0x04, 0x5D, 0x20, 0x9F,
+  0x5C, 0x72, 0x05, 0x30, 0x1E, 0x01, 0xC7, 0x90, 0x75, 0x0D, 0x05, 0x47, 0x1D, 0x00, 0xCB, 0xF5,
+  0xBA, 0x5A, 0x43, 0x50, 0xF3, 0x0E, 0x3D, 0x03, 0xA8, 0x67, 0x08, 0xE9, 0x30, 0xCB, 0xE5, 0xEF,
+  0xE3, 0xC7, 0xE7, 0x19, 0x7A, 0xCB, 0xE5, 0xEF, 0xE3, 0xC7, 0xE7, 0x17, 0x9F, 0xCE, 0x3A, 0x10,
+  0xA8, 0x83, 0xA8, 0x7F, 0x8E, 0xDF, 0x7B, 0x07, 0x98, 0x6A, 0x2D, 0x23, 0xA8, 0xCA, 0xCE, 0xE3,
+  0xB7, 0xE8, 0xFD, 0xC7, 0x60, 0xCB, 0xC8, 0x04, 0xE3, 0x42, 0x08, 0x00, 0x8B, 0x8F, 0x71, 0xA0,
+  0xCA, 0xB6, 0x5C, 0x96, 0x25, 0x89, 0x85, 0xC2, 0xE1, 0x70, 0xB9, 0x33, 0x25, 0x81, 0x33, 0x6E,
+  0xCC, 0x99, 0x93, 0x36, 0xE0, 0xCA, 0xE3, 0x8F, 0xD3, 0xD0, 0xCB, 0x34, 0xC6, 0xCD, 0xE0, 0x19,
+  0xB7, 0x75, 0x09, 0x0F, 0xA8, 0x30, 0xF3, 0x00, 0x3F, 0x60, 0x1F, 0xD8, 0xCB, 0x33, 0x9B, 0xE4,
+  0xD0, 0x9A, 0x39, 0xB4, 0x26, 0x8E, 0x6D, 0x09, 0xA3, 0x9B, 0x42, 0x68, 0xF9, 0x18, 0x9E, 0xDF,
+  0xE9, 0x0A, 0x06, 0x17, 0x0E, 0x81, 0x80, 0xE3, 0xD4, 0x30, 0x1D, 0x02, 0xE0, 0xC2, 0x82, 0x7E,
+  0x60, 0xCB, 0xD9, 0xE1, 0x5D, 0xA0, 0x7D, 0x42, 0xC0, 0xF8, 0x23, 0xBC, 0x50, 0x9E, 0xDF, 0xE9,
+  0x0A, 0x06, 0x17, 0x0E, 0x81, 0x80, 0xE3, 0xD4, 0x30, 0x1D, 0x02, 0xE0, 0xC2, 0x82, 0x7D, 0x17,
+  0xDE, 0x64, 0xD8, 0x9B, 0x10, 0xCB, 0xDA, 0xE1, 0x66, 0xD4, 0x3F, 0x60, 0xBA, 0xB8, 0x51, 0xBA,
+  0x87, 0x80, 0x6A, 0xCD, 0xA8, 0x00, 0x7E, 0x9E, 0x90, 0xA7, 0x93, 0x4A, 0x91, 0x4A, 0x68, 0xA5,
+  0x38, 0xD6, 0x68, 0xF1, 0xCA, 0x47, 0xA0, 0xCB, 0xFE, 0x5D, 0xE3, 0x8E, 0x28, 0xCA, 0xCE, 0xE3,
+  0x8F, 0xB8, 0x58, 0x00, 0x90, 0x63, 0xC4, 0xCA, 0xC6, 0x0F, 0x07, 0x20, 0x1F, 0x00, 0x96, 0x8A,
+  0x72, 0x59, 0xA2, 0x1C, 0x99, 0xB4, 0x27, 0x26, 0x6E, 0x69, 0xCB, 0x2D, 0x5F, 0x2E, 0x4A, 0x78,
+  0xBC, 0x96, 0x0C, 0xD4, 0x16, 0x78, 0xBC, 0x81, 0x20, 0x39, 0xAC, 0x1F, 0xA8, 0x66, 0x21, 0xF9,
+  0x87, 0x46, 0xEE, 0xE7, 0x40, 0x2B, 0xD0, 0xA4, 0x30, 0x61, 0x01, 0x62, 0x5D, 0x4B, 0x08, 0x78,
+  0xB6, 0x6A, 0x21, 0xF1, 0x04, 0x12, 0xBA, 0x90, 0x90, 0xA0, 0x1A, 0x80, 0xCA, 0xBD, 0xA8, 0x50,
+  0x6C, 0x10, 0x12, 0x4A, 0x52, 0xD5, 0xD0, 0xEF, 0x27, 0x1B, 0x00, 0xCB, 0xF8, 0x7B, 0xBA, 0xE1,
+  0x76, 0xCB, 0xB6, 0x5D, 0xB2, 0xE1, 0xF0, 0x0B, 0xB6, 0x5D, 0xBF, 0xE0, 0xCB, 0xAB, 0x78, 0xFA,
+  0xE8, 0xCA, 0xB0, 0x73, 0x0F, 0x20, 0xEE, 0x53, 0xB8, 0x3C, 0x83, 0xB8, 0xCB, 0xEE, 0x3E, 0xBA,
+  0x80, 0x96, 0x03, 0xE0, 0x03, 0x01, 0x21, 0xB8, 0x4B, 0x35, 0x03, 0x66, 0xB8, 0x00, 0xCB, 0xF8,
+  0xCB, 0x12, 0x41, 0x80, 0x5D, 0x9D, 0x0D, 0x01, 0xE9, 0xD6, 0x38, 0x83, 0xAA, 0x0C, 0xE3, 0x02,
+  0xCA, 0xFE, 0x39, 0x23, 0x04, 0x98, 0x34, 0x87, 0x12, 0x90, 0x66, 0x0C, 0x60, 0x40, 0x7D, 0x43,
+  0x50, 0x44, 0x3F, 0xE0, 0x58, 0x20, 0x86, 0x80, 0xCE, 0xFF, 0x1C, 0x91, 0x81, 0x83, 0x30, 0x97,
+  0x12, 0x12, 0x93, 0x44, 0x60, 0x40, 0x7C, 0x91, 0x84, 0x81, 0xA5, 0x22, 0xD7, 0xC8, 0xFD, 0xD5,
+  0x76, 0x81, 0x26, 0x38, 0x80, 0x8E, 0x31, 0xA8, 0x3C, 0x25, 0xA4, 0xB7, 0x8F, 0xD4, 0x7C, 0x24,
+  0x30, 0x30, 0x66, 0x12, 0xE2, 0x42, 0x4C, 0x1A, 0x46, 0x09, 0xE7, 0xA8, 0x14, 0x2B, 0x48, 0xCA,
+  0xFE, 0x3B, 0x03, 0x44, 0x20, 0x13, 0x8F, 0x60, 0xCB, 0x6A, 0xEA, 0x8A, 0x2F, 0x0B, 0x8F, 0xA7,
+  0x40, 0xCA, 0xFF, 0x79, 0x44, 0x92, 0x49, 0x2E, 0xA0, 0xA2, 0x59, 0x70, 0x18, 0x58, 0x96, 0x60,
+  0x00, 0xCA, 0xFD, 0x00, 0xCA, 0x38, 0xF9, 0x03, 0x0F, 0x04, 0x1A, 0xC0, 0x96, 0x71, 0xC7, 0xDC,
+  0xCA, 0x3B, 0x03, 0x44, 0x20, 0x13, 0x8F, 0x60, 0x7D, 0x91, 0xA1, 0x84, 0x00, 0x14, 0xD9, 0xEE,
+  0xC1, 0x28, 0xC2, 0x01, 0x8D, 0x08, 0xCA, 0x39, 0x23, 0x04, 0x98, 0x34, 0x87, 0x12, 0x90, 0x66,
+  0x0C, 0x60, 0x9E, 0x7F, 0x20, 0x7C, 0x24, 0x30, 0x30, 0x66, 0x12, 0xE2, 0x42, 0x52, 0x68, 0x8C,
+  0x13, 0xCF, 0xE4, 0xCA, 0x58, 0xB8, 0xD2, 0xE2, 0x00, 0x5E, 0x03, 0x48, 0x43, 0x5A, 0x4E, 0x84,
+  0x4E, 0x84, 0x59, 0xB4, 0x48, 0x1C, 0x00, 0x6A, 0x6D, 0x2E, 0xAD, 0xE3, 0x40, 0xA1, 0x80, 0xCA,
+  0xB5, 0xC7, 0xB1, 0x04, 0x20, 0x68, 0x40, 0xCA, 0xBE, 0x0A, 0x6C, 0x6C, 0xD4, 0xD9, 0x2C, 0xD0,
+  0x1D, 0x03, 0x50, 0xEF, 0x58, 0xCB, 0x27, 0x27, 0x3E, 0xC0, 0x33, 0x68, 0x03, 0xC0, 0x00, 0xEF,
+  0x48, 0x68, 0xA0, 0xF8, 0x87, 0x7A, 0x49, 0xA0, 0xCA, 0xAD, 0x16, 0x33, 0x04, 0x85, 0x03, 0x58,
+  0x29, 0x86, 0xA1, 0x20, 0xCD, 0x04, 0x08, 0xD2, 0x90, 0xCA, 0xBC, 0x94, 0x2F, 0x34, 0x02, 0x74,
+  0x50, 0x43, 0xC1, 0x42, 0xEA, 0xBB, 0xC4, 0x3E, 0x01, 0x58, 0x2C, 0xCB, 0xFD, 0xD1, 0x21, 0xB8,
+  0x4B, 0x09, 0x0D, 0xC2, 0x42, 0xFE, 0x00, 0x9C, 0x81, 0x30, 0xF6, 0x07, 0xB1, 0xB4, 0x1F, 0xF8,
+  0x14, 0x20, 0xCA, 0xFE, 0xE0, 0xCB, 0x26, 0x14, 0x1F, 0xDC, 0x2B, 0x63, 0x58, 0x7F, 0xA0, 0x70,
+  0x80, 0x39, 0x1C, 0x5A, 0x1D, 0x00, 0xCB, 0x2B, 0x1D, 0xFA, 0x00, 0x8B, 0x91, 0x61, 0x1B, 0x08,
+  0x87, 0xFD, 0x86, 0x68, 0x05, 0xAE, 0x59, 0xDC, 0x8F, 0x20, 0x6C, 0x84, 0x5F, 0xFF, 0x2E, 0x39,
+  0x73, 0x80, 0x2E, 0x5F, 0x80, 0xC9, 0x71, 0xD0, 0x17, 0x08, 0x40, 0x76, 0x08, 0x12, 0xE0, 0x3A,
+  0x00, 0xCB, 0x2D, 0xBA, 0x00, 0x96, 0xE6, 0x0D, 0xBA, 0x40, 0x6E, 0xB0, 0x5F, 0x22, 0x8D, 0x59,
+  0xDB, 0x56, 0x46, 0xAC, 0xF9, 0x00, 0xCA, 0xE7, 0x62, 0xE6, 0x5F, 0x8D, 0x09, 0x0C, 0x0A, 0x8A,
+  0x80, 0x50, 0x04, 0x94, 0xDA, 0x93, 0xC0, 0x59, 0xE2, 0x53, 0x44, 0x81, 0xC0, 0x00, 0xCA, 0x70,
+  0xAE, 0xE3, 0xEA, 0x85, 0x05, 0x87, 0x40, 0x60, 0x0E, 0x20, 0x1D, 0xE0, 0x2E, 0x1C, 0x68, 0x02,
+  0x0C, 0x50, 0x36, 0xE0, 0xBA, 0x82, 0x57, 0x54, 0x28, 0x55, 0xF4, 0x00, 0xCB, 0x87, 0x4D, 0x06,
+  0x25, 0xC7, 0x00, 0x89, 0x4C, 0x28, 0x10, 0x00, 0x80, 0x04, 0x08, 0x10, 0x4A, 0x08, 0x82, 0x48,
+  0x03, 0x05, 0x00, 0xCB, 0xFB, 0xFB, 0x80, 0xCB, 0xA0, 0xAE, 0xE3, 0xEA, 0x85, 0x05, 0xBC, 0x40,
+  0xC1, 0xE0, 0x40, 0x3B, 0xDA, 0x86, 0x6E, 0x51, 0x6D, 0x0F, 0xC9, 0x40, 0xC5, 0xDC, 0x14, 0x00,
+  0x4E, 0x46, 0x54, 0x28, 0x55, 0xF4, 0x00, 0xCB, 0xFC, 0x5A, 0xC4, 0x00, 0x41, 0xCC, 0x10, 0x02,
+  0x00, 0x9B, 0xDF, 0x8B, 0xF2, 0xDF, 0xF3, 0x72, 0xFE, 0x00, 0x35, 0xE8, 0xDD, 0x01, 0x07, 0x34,
+  0x16, 0x00, 0x35, 0x0D, 0x2E, 0x67, 0x81, 0x76, 0x57, 0x41, 0x68, 0x58, 0x11, 0x80, 0x40, 0xCA,
+  0xB5, 0xC7, 0xB2, 0x10, 0xAD, 0x11, 0xD2, 0xFF, 0x60, 0x7F, 0x25, 0x4D, 0xFA, 0xB5, 0x7F, 0xA6,
+  0xD2, 0x62, 0xE3, 0xDC, 0xCB, 0x28, 0x46, 0xA2, 0x84, 0xE0, 0x50, 0x40, 0x5E, 0x60, 0x58, 0xF8,
+  0x4E, 0xF8, 0xCE, 0x38, 0x00, 0xCA, 0x55, 0xC1, 0x82, 0x06, 0x08, 0x18, 0x41, 0x04, 0x04, 0x19,
+  0x02, 0x30, 0x45, 0x20, 0x60, 0x59, 0x6A, 0x19, 0x83, 0x0D, 0xEB, 0x87, 0x26, 0xEE, 0x41, 0xDF,
+  0x66, 0x09, 0xA9, 0x2F, 0x09, 0x66, 0x0A, 0xDD, 0xA0, 0x44, 0xA9, 0x3D, 0x53, 0x72, 0x0D, 0x40,
+  0x59, 0x6A, 0x19, 0x83, 0x0B, 0x04, 0x5D, 0x43, 0x93, 0x77, 0x20, 0x39, 0xB6, 0x0A, 0x04, 0xBC,
+  0x9B, 0xAE, 0xA0, 0xA2, 0x72, 0x40, 0x50, 0x40, 0x50, 0x6C, 0x5A, 0x39, 0x7A, 0x30, 0x50, 0x37,
+  0xC8, 0x23, 0xB0, 0x13, 0x85, 0xC9, 0x21, 0xB8, 0x38, 0x36, 0x68, 0xC4, 0x01, 0x4F, 0xAC, 0x9A,
+  0x98, 0x60, 0x1B, 0x52, 0x18, 0x92, 0x8E, 0x24, 0x07, 0x36, 0xA0, 0x8C, 0xEB, 0x9C, 0xEE, 0x4B,
+  0x12, 0x09, 0x04, 0x82, 0x59, 0xD4, 0x24, 0x0E, 0x00, 0x9B, 0x93, 0x57, 0x20, 0xD9, 0xC9, 0xAE,
+  0x76, 0x60, 0x3B, 0x05, 0xC3, 0xBD, 0x49, 0x61, 0xBF, 0x12, 0x07, 0x9C, 0x81, 0x07, 0xD0, 0x43,
+  0x50, 0xCE, 0xD5, 0xB1, 0x36, 0x68, 0x1A, 0xDB, 0x67, 0x66, 0x03, 0xB0, 0x5C, 0x3B, 0xD4, 0x96,
+  0x1B, 0xF1, 0x20, 0x79, 0xC8, 0x10, 0x7D, 0x04, 0x35, 0xB5, 0xAB, 0x60, 0x19, 0x80, 0x19, 0x98,
+  0x59, 0x36, 0x79, 0xD9, 0x80, 0xEC, 0x17, 0x0E, 0xF5, 0x25, 0x86, 0xFC, 0x48, 0x1E, 0x72, 0x04,
+  0x1F, 0x41, 0x0D, 0x40, 0x8D, 0x6A, 0x11, 0xB5, 0x2D, 0xF2, 0xCE, 0xCC, 0x07, 0x60, 0xB8, 0x77,
+  0xA9, 0x2C, 0x37, 0xE2, 0x40, 0xF3, 0x90, 0x20, 0xFA, 0x08, 0x6A, 0x89, 0xD7, 0x9D, 0xFD, 0xB3,
+  0xCC, 0x07, 0x54, 0xB0, 0x1D, 0x56, 0x5C, 0xDE, 0x05, 0xC4, 0xAF, 0x24, 0x2C, 0x1F, 0xD0, 0x33,
+  0x0E, 0x40, 0xAD, 0xD0, 0x43, 0xEC, 0x21, 0xA1, 0x35, 0x26, 0xED, 0x41, 0x3F, 0x22, 0x0B, 0xBB,
+  0x04, 0x05, 0xFB, 0x61, 0xE8, 0xF8, 0xAE, 0x09, 0xD8, 0x30, 0x00, 0xBF, 0xF9, 0x9C, 0xBC, 0xB3,
+  0xE8, 0x1F, 0x30, 0xF9, 0x85, 0x79, 0xB7, 0x8C, 0xB9, 0xBF, 0x74, 0x0F, 0x9B, 0xE2, 0xE6, 0xD7,
+  0xC0, 0x9F, 0x5C, 0x72, 0x05, 0x30, 0x1E, 0x01, 0xC7, 0x90, 0x75, 0x0D, 0x05, 0x47, 0x1D, 0xA8,
+  0xE5, 0x35, 0x16, 0x1E, 0x38, 0x18, 0x56, 0x16, 0x60, 0x2E, 0x17, 0x9F, 0xCB, 0xDF, 0xC7, 0x8F,
+  0xCE, 0x32, 0xF4, 0xAA, 0xCD, 0x14, 0x17, 0x5D, 0x3F, 0x2F, 0x7F, 0x1E, 0x3F, 0x38, 0xCB, 0xD0,
+  0x8A, 0xC4, 0x95, 0xCA, 0x11, 0x20, 0x49, 0x8F, 0x97, 0xBF, 0x8F, 0x1F, 0x9C, 0x65, 0xE8, 0x52,
+  0xA2, 0x57, 0x87, 0xCB, 0xDF, 0xC7, 0x8F, 0xCE, 0x32, 0xF4, 0xCA, 0xA3, 0x23, 0x50, 0x44, 0x79,
+  0x00, 0x9C, 0x68, 0x41, 0x00, 0x89, 0xAC, 0x41, 0x08, 0x3F, 0x20, 0x13, 0x8D, 0x08, 0x20, 0x74,
+  0x93, 0x41, 0x00, 0x10, 0xC8, 0x8E, 0xA4, 0x19, 0x38, 0xFD, 0x48, 0xD0, 0x00, 0xCA, 0x7A, 0xED,
+  0xFA, 0x20, 0x89, 0xC7, 0x52, 0x24, 0x00, 0x5E, 0xE7, 0xC2, 0xD6, 0x1B, 0x07, 0xC8, 0x3B, 0x4B,
+  0x6D, 0x2D, 0xFF, 0x21, 0xE6, 0x18, 0x85, 0x70, 0x98, 0x7A, 0xD6, 0xED, 0x8F, 0x7A, 0x66, 0x73,
+  0x7C, 0x9A, 0x13, 0x47, 0x36, 0x84, 0xD1, 0xCD, 0xA1, 0x34, 0x73, 0x68, 0x4D, 0x1F, 0x23, 0x9B,
+  0x9B, 0x62, 0x6D, 0x0D, 0xEF, 0xCB, 0xB7, 0xFA, 0x42, 0x81, 0x85, 0xC3, 0xA0, 0x60, 0x38, 0xF5,
+  0x0C, 0x07, 0x40, 0xB8, 0x30, 0xA0, 0x9F, 0x98, 0xCF, 0x35, 0x26, 0xED, 0x43, 0x6B, 0xE5, 0xDB,
+  0xFD, 0x21, 0x40, 0xC2, 0xE1, 0xD0, 0x30, 0x1C, 0x7A, 0x86, 0x03, 0xA0, 0x5C, 0x18, 0x50, 0x4F,
+  0xCC, 0xB5, 0xB1, 0x34, 0x10, 0xCC, 0x10, 0x5E, 0x8B, 0xCB, 0xB7, 0xFA, 0x42, 0x81, 0x85, 0xC3,
+  0xA0, 0x60, 0x38, 0xF5, 0x0C, 0x07, 0x40, 0xB8, 0x30, 0xA0, 0x9F, 0x98, 0x9C, 0x75, 0xB0, 0x35,
+  0x1E, 0xDE, 0x8C, 0xF2, 0xED, 0xFE, 0x90, 0xA0, 0x61, 0x70, 0xE8, 0x18, 0x0E, 0x3D, 0x43, 0x01,
+  0xD0, 0x2E, 0x0C, 0x28, 0x27, 0xE6, 0x99, 0x58, 0x95, 0xF6, 0xED, 0xFE, 0x90, 0xA0, 0x61, 0x70,
+  0xE8, 0x18, 0x0E, 0x3D, 0x43, 0x01, 0xD0, 0x2E, 0x0C, 0x28, 0x27, 0xE6, 0xCA, 0xA9, 0x20, 0x48,
+  0x81, 0x14, 0x22, 0x4A, 0x24, 0x82, 0x30, 0x08, 0x03, 0x80, 0xA8, 0x9F, 0x0A, 0x3D, 0x01, 0x86,
+  0x64, 0x14, 0xE8, 0x50, 0xA0, 0x18, 0x0D, 0x5D, 0x1A, 0x86, 0xAE, 0x8C, 0x00, 0xA1, 0x27, 0x45,
+  0x02, 0x66, 0x0C, 0x0F, 0x58, 0x79, 0x82, 0x61, 0xB0, 0x69, 0x77, 0x59, 0xDC, 0x71, 0xF7, 0x0B,
+  0x00, 0x12, 0x0C, 0x78, 0x80, 0xBD, 0x80, 0xCC, 0x33, 0x0C, 0x5D, 0xF6, 0x77, 0x1C, 0x7D, 0xC2,
+  0xC0, 0x04, 0x83, 0x1E, 0x20, 0x9C, 0xF0, 0x01, 0x60, 0x02, 0xA7, 0x73, 0xB3, 0xB8, 0xE3, 0xEE,
+  0x16, 0x00, 0x24, 0x18, 0xF1, 0x00, 0x73, 0xAA, 0x77, 0xE7, 0x67, 0x71, 0xC7, 0xDC, 0x2C, 0x00,
+  0x48, 0x31, 0xE2, 0xB5, 0x9B, 0x65, 0xC3, 0x0C, 0x2A, 0xBD, 0xA8, 0x50, 0x6C, 0x10, 0x12, 0x4A,
+  0x52, 0xD5, 0xD0, 0xEF, 0x27, 0x1B, 0x00, 0xCA, 0xF5, 0xEC, 0xF0, 0xAE, 0xD0, 0x3E, 0xA1, 0x60,
+  0x7C, 0x11, 0xDF, 0x98, 0x5D, 0x91, 0xA1, 0x84, 0x07, 0xC5, 0xB2, 0xE1, 0x70, 0xF1, 0x66, 0x55,
+  0xCD, 0x79, 0x33, 0x76, 0x40, 0x4E, 0x80, 0x76, 0x16, 0x60, 0x2F, 0x4F, 0x67, 0x43, 0x40, 0x7A,
+  0x75, 0x8E, 0x20, 0xEA, 0x83, 0x38, 0xC0, 0x80, 0xAC, 0xA2, 0x5D, 0x41, 0x6A, 0xBB, 0x3A, 0x1A,
+  0x03, 0xD3, 0xAC, 0x71, 0x07, 0x54, 0x19, 0xC6, 0x04, 0x8C, 0xA3, 0x40, 0xA4, 0x16, 0x2A, 0x4F,
+  0xB3, 0xA1, 0xA0, 0x3D, 0x3A, 0xC7, 0x10, 0x75, 0x41, 0x9C, 0x60, 0x40, 0x5A, 0xA0, 0x44, 0x09,
+  0x6E, 0xDD, 0x9D, 0x0D, 0x01, 0xE9, 0xD6, 0x38, 0x83, 0xAA, 0x0C, 0xE3, 0x02, 0x53, 0x9C, 0xEF,
+  0x1E, 0xCE, 0x86, 0x80, 0xF4, 0xEB, 0x1C, 0x41, 0xD5, 0x06, 0x71, 0x84, 0x00, 0x8D, 0x91, 0x0D,
+  0xC4, 0x27, 0x77, 0xED, 0x71, 0xD1, 0x7A, 0xF5, 0x7A, 0x07, 0x90, 0x08, 0x31, 0xD0, 0x5D, 0x7B,
+  0x03, 0x4F, 0xCA, 0x85, 0x9A, 0xA9, 0xF1, 0xE2, 0xEB, 0xF1, 0x7E, 0x1F, 0xC9, 0x2C, 0x0C, 0x12,
+  0x08, 0x60, 0x23, 0x50, 0x7D, 0x43, 0x50, 0x44, 0x3F, 0xE0, 0x58, 0x20, 0x86, 0xC4, 0x64, 0x2E,
+  0x2A, 0x72, 0xC0, 0x00, 0x59, 0x72, 0x5C, 0x97, 0xB4, 0x5B, 0x92, 0x30, 0x90, 0x34, 0xA4, 0x5A,
+  0xF9, 0x1F, 0xBA, 0xAE, 0xD0, 0x24, 0xC7, 0x10, 0xAC, 0xC2, 0xC1, 0x60, 0xBD, 0x7E, 0x48, 0xC2,
+  0x40, 0xD2, 0x91, 0x6B, 0xE4, 0x7E, 0xEA, 0xBB, 0x40, 0x93, 0x1C, 0x40, 0x8C, 0xB1, 0xA4, 0x60,
+  0x60, 0xC1, 0x53, 0x47, 0x24, 0x61, 0x20, 0x69, 0x48, 0xB5, 0xF2, 0x3F, 0x75, 0x5D, 0xA0, 0x49,
+  0x8E, 0x20, 0x53, 0xA2, 0x77, 0xE5, 0xC9, 0x18, 0x48, 0x1A, 0x52, 0x2D, 0x7C, 0x8F, 0xDD, 0x57,
+  0x68, 0x12, 0x63, 0x88, 0xCB, 0x04, 0x02, 0xAA, 0xF7, 0x50, 0x20, 0x55, 0x7E, 0xE0, 0x74, 0x91,
+  0x88, 0x18, 0xB6, 0x8E, 0xE3, 0xE6, 0xCA, 0x5A, 0xAD, 0xEE, 0x34, 0x84, 0x24, 0x68, 0x8A, 0x29,
+  0x60, 0x49, 0x32, 0x6A, 0x11, 0xE4, 0x0D, 0x00, 0x08, 0x30, 0xA7, 0xEE, 0x14, 0x00, 0x40, 0x31,
+  0xA1, 0x00, 0x5A, 0xCB, 0x4D, 0x47, 0xBB, 0x47, 0x60, 0x68, 0x84, 0x02, 0x71, 0xEC, 0x79, 0x9B,
+  0x50, 0xC0, 0x62, 0xB7, 0x64, 0x68, 0x61, 0x00, 0x05, 0x36, 0x7B, 0xB0, 0x4A, 0x30, 0x80, 0x63,
+  0x42, 0xB6, 0x5C, 0x96, 0x26, 0x76, 0x6C, 0xFB, 0x23, 0x43, 0x08, 0x00, 0x29, 0xB3, 0xDD, 0x82,
+  0x51, 0x84, 0x03, 0x1A, 0x10, 0x8C, 0xD5, 0x61, 0x09, 0xC4, 0x10, 0x9A, 0x7B, 0x23, 0x43, 0x08,
+  0x00, 0x29, 0xB3, 0xDD, 0x82, 0x51, 0x84, 0x03, 0x1A, 0x10, 0x5A, 0xD3, 0xD9, 0x3D, 0xE9, 0xD9,
+  0x1A, 0x18, 0x40, 0x01, 0x4D, 0x9E, 0xEC, 0x12, 0x8C, 0x20, 0x18, 0xD0, 0x80, 0x72, 0xAA, 0x57,
+  0x6E, 0xC8, 0xD0, 0xC2, 0x00, 0x0A, 0x6C, 0xF7, 0x60, 0x94, 0x61, 0x00, 0xC6, 0x84, 0x9B, 0xFA,
+  0x5C, 0xBF, 0xBC, 0xEF, 0x30, 0x7E, 0xB1, 0xB2, 0x18, 0x40, 0x14, 0xB6, 0x5C, 0x2E, 0x1F, 0x00,
+  0x98, 0x08, 0x60, 0x27, 0x42, 0x59, 0x72, 0x5E, 0x19, 0xDC, 0xAB, 0x5C, 0x7B, 0x10, 0x42, 0x06,
+  0x84, 0xAC, 0xC2, 0xC1, 0x7B, 0x95, 0x6B, 0x8F, 0x62, 0x08, 0x40, 0xD0, 0x80, 0x8C, 0xB1, 0xA4,
+  0x60, 0x89, 0xDB, 0x56, 0xB8, 0xF6, 0x20, 0x84, 0x0D, 0x08, 0x53, 0xA2, 0x77, 0x5A, 0xD7, 0x1E,
+  0xC4, 0x10, 0x81, 0xA1, 0x00, 0xB5, 0x98, 0x5C, 0x33, 0xBA, 0x57, 0x92, 0x85, 0xE6, 0x80, 0x4E,
+  0x8A, 0x08, 0x78, 0x28, 0x5D, 0x57, 0x78, 0x87, 0xC0, 0x2B, 0x05, 0x80, 0xCA, 0xFE, 0x39, 0x23,
+  0x04, 0x98, 0x34, 0x87, 0x12, 0x90, 0x66, 0x0F, 0x82, 0xB7, 0xF9, 0x73, 0xAA, 0x77, 0xE7, 0x96,
+  0xDD, 0x1B, 0x84, 0x87, 0x73, 0x09, 0x0F, 0x80, 0x5D, 0x2E, 0xAB, 0x87, 0x9B, 0xC0, 0x33, 0x67,
+  0x85, 0x60, 0xCB, 0x1E, 0x3C, 0xEC,
+};
+
+static const pGLYPH FontNoto24_Glyphs[] = {
+  /* offset, width, height, advance, left, top */
+  {    0,  0,  0,  6,  0, 26}, /* ' ' */
+  {    0,  3, 17,  7,  2,  9}, /* '!' */
+  {    4,  6,  6, 10,  2,  9}, /* '"' */
+  {    8, 14, 17, 16,  1,  9}, /* '#' */
+  {   30, 11, 20, 13,  1,  8}, /* '$' */
+  {   50, 18, 17, 20,  1,  9}, /* '%' */
+  {   79, 15, 17, 17,  1,  9}, /* '&' */
+  {  106,  2,  6,  5,  2,  9}, /* '\'' */
+  {  109,  5, 21,  7,  1,  9}, /* '(' */
+  {  117,  5, 21,  7,  1,  9}, /* ')' */
+  {  126, 11, 11, 13,  1,  8}, /* '*' */
+  {  140, 11, 11, 13,  1, 12}, /* '+' */
+  {  146,  4,  6,  6,  1, 23}, /* ',' */
+  {  149,  6,  1,  8,  1, 19}, /* '-' */
+  {  151,  3,  3,  7,  2, 23}, /* '.' */
+  {  153,  9, 17,  9,  0,  9}, /* '/' */
+  {  164, 11, 17, 14,  1,  9}, /* '0' */
+  {  179,  6, 17, 14,  2,  9}, /* '1' */
+  {  185, 11, 17, 14,  1,  9}, /* '2' */
+  {  203, 12, 17, 14,  1,  9}, /* '3' */
+  {  221, 13, 17, 14,  1,  9}, /* '4' */
+  {  237, 11, 17, 14,  1,  9}, /* '5' */
+  {  251, 11, 17, 14,  1,  9}, /* '6' */
+  {  270, 11, 17, 14,  1,  9}, /* '7' */
+  {  284, 11, 17, 14,  1,  9}, /* '8' */
+  {  304, 11, 17, 14,  1,  9}, /* '9' */
+  {  322,  3, 13,  7,  2, 13}, /* ':' */
+  {  327,  4, 16,  7,  1, 13}, /* ';' */
+  {  333, 12, 11, 14,  1, 12}, /* '<' */
+  {  349, 11,  6, 13,  1, 14}, /* '=' */
+  {  353, 12, 11, 14,  1, 12}, /* '>' */
+  {  369,  9, 17, 11,  1,  9}, /* '?' */
+  {  384, 19, 18, 21,  1,  9}, /* '@' */
+  {  414, 15, 17, 15,  0,  9}, /* 'A' */
+  {  432, 12, 17, 15,  2,  9}, /* 'B' */
+  {  447, 13, 17, 15,  1,  9}, /* 'C' */
+  {  462, 14, 17, 17,  2,  9}, /* 'D' */
+  {  477, 10, 17, 13,  2,  9}, /* 'E' */
+  {  485, 10, 17, 12,  2,  9}, /* 'F' */
+  {  492, 14, 17, 17,  1,  9}, /* 'G' */
+  {  509, 13, 17, 17,  2,  9}, /* 'H' */
+  {  517,  6, 17,  8,  1,  9}, /* 'I' */
+  {  524,  6, 21,  6, -2,  9}, /* 'J' */
+  {  528, 12, 17, 14,  2,  9}, /* 'K' */
+  {  549, 10, 17, 12,  2,  9}, /* 'L' */
+  {  554, 17, 17, 21,  2,  9}, /* 'M' */
+  {  572, 14, 17, 18,  2,  9}, /* 'N' */
+  {  590, 16, 17, 18,  1,  9}, /* 'O' */
+  {  609, 11, 17, 14,  2,  9}, /* 'P' */
+  {  621, 16, 21, 18,  1,  9}, /* 'Q' */
+  {  645, 12, 17, 15,  2,  9}, /* 'R' */
+  {  662, 11, 17, 13,  1,  9}, /* 'S' */
+  {  679, 13, 17, 15,  1,  9}, /* 'T' */
+  {  685, 13, 17, 17,  2,  9}, /* 'U' */
+  {  695, 14, 17, 14,  0,  9}, /* 'V' */
+  {  714, 22, 17, 22,  0,  9}, /* 'W' */
+  {  741, 14, 17, 14,  0,  9}, /* 'X' */
+  {  764, 12, 17, 14,  1,  9}, /* 'Y' */
+  {  779, 12, 17, 14,  1,  9}, /* 'Z' */
+  {  796,  6, 20,  8,  2,  9}, /* '[' */
+  {  801,  9, 17,  9,  0,  9}, /* '\\' */
+  {  812,  6, 20,  8,  0,  9}, /* ']' */
+  {  817, 12, 11, 14,  1,  9}, /* '^' */
+  {  830, 11,  1, 11,  0, 28}, /* '_' */
+  {  832,  5,  4,  7,  1,  8}, /* '`' */
+  {  836, 10, 13, 13,  1, 13}, /* 'a' */
+  {  848, 11, 18, 14,  2,  8}, /* 'b' */
+  {  862,  9, 13, 11,  1, 13}, /* 'c' */
+  {  872, 11, 18, 14,  1,  8}, /* 'd' */
+  {  886, 11, 13, 13,  1, 13}, /* 'e' */
+  {  901,  9, 18, 10,  1,  8}, /* 'f' */
+  {  910, 11, 19, 14,  1, 13}, /* 'g' */
+  {  927, 11, 18, 15,  2,  8}, /* 'h' */
+  {  936,  2, 18,  6,  2,  8}, /* 'i' */
+  {  939,  6, 24,  6, -2,  8}, /* 'j' */
+  {  945, 10, 18, 13,  2,  8}, /* 'k' */
+  {  961,  2, 18,  6,  2,  8}, /* 'l' */
+  {  964, 18, 13, 22,  2, 13}, /* 'm' */
+  {  976, 11, 13, 15,  2, 13}, /* 'n' */
+  {  984, 12, 13, 14,  1, 13}, /* 'o' */
+  {  998, 11, 19, 14,  2, 13}, /* 'p' */
+  { 1013, 11, 19, 14,  1, 13}, /* 'q' */
+  { 1027,  7, 13, 10,  2, 13}, /* 'r' */
+  { 1033,  9, 13, 11,  1, 13}, /* 's' */
+  { 1047,  8, 16, 10,  1, 10}, /* 't' */
+  { 1055, 11, 13, 15,  2, 13}, /* 'u' */
+  { 1063, 12, 13, 12,  0, 13}, /* 'v' */
+  { 1077, 18, 13, 19,  0, 13}, /* 'w' */
+  { 1096, 11, 13, 13,  1, 13}, /* 'x' */
+  { 1113, 12, 19, 12,  0, 13}, /* 'y' */
+  { 1131,  9, 13, 11,  1, 13}, /* 'z' */
+  { 1143,  8, 20, 10,  1,  9}, /* '{' */
+  { 1154,  2, 24, 14,  6,  8}, /* '|' */
+  { 1157,  8, 20,  9,  0,  9}, /* '}' */
+  { 1169, 11,  3, 13,  1, 16}, /* '~' */
+  { 1174,  0,  0,  6,  0, 26}, /* U+00A0 */
+  { 1174,  3, 17,  7,  2, 13}, /* U+00A1 ¡ */
+  { 1179,  9, 17, 13,  2,  9}, /* U+00A2 ¢ */
+  { 1192, 12, 17, 14,  1,  9}, /* U+00A3 £ */
+  { 1205, 10, 10, 14,  2, 12}, /* U+00A4 ¤ */
+  { 1217, 13, 17, 13,  0,  9}, /* U+00A5 ¥ */
+  { 1238,  2, 24, 14,  6,  8}, /* U+00A6 ¦ */
+  { 1242,  9, 18, 13,  2,  8}, /* U+00A7 § */
+  { 1262,  7,  1, 15,  4,  9}, /* U+00A8 ¨ */
+  { 1264, 18, 17, 20,  1,  9}, /* U+00A9 © */
+  { 1292,  6,  7,  8,  1,  9}, /* U+00AA ª */
+  { 1299, 10, 10, 13,  1, 15}, /* U+00AB « */
+  { 1315, 12,  6, 14,  1, 17}, /* U+00AC ¬ */
+  { 1319,  6,  1,  8,  1, 19}, /* U+00AD ­ */
+  { 1321, 18, 17, 20,  1,  9}, /* U+00AE ® */
+  { 1351, 12,  1, 12,  0,  7}, /* U+00AF ¯ */
+  { 1353,  8,  7, 10,  1,  9}, /* U+00B0 ° */
+  { 1361, 11, 14, 13,  1, 12}, /* U+00B1 ± */
+  { 1370,  6, 10,  8,  1,  6}, /* U+00B2 ² */
+  { 1378,  7, 11,  9,  1,  5}, /* U+00B3 ³ */
+  { 1387,  5,  4,  7,  1,  8}, /* U+00B4 ´ */
+  { 1391, 11, 19, 15,  2, 13}, /* U+00B5 µ */
+  { 1401, 13, 21, 17,  1,  8}, /* U+00B6 ¶ */
+  { 1412,  3,  3,  7,  2, 16}, /* U+00B7 · */
+  { 1414,  5,  6,  6,  0, 26}, /* U+00B8 ¸ */
+  { 1418,  4, 10,  8,  1,  6}, /* U+00B9 ¹ */
+  { 1422,  7,  8,  9,  1,  9}, /* U+00BA º */
+  { 1429, 10, 10, 12,  1, 15}, /* U+00BB » */
+  { 1445, 17, 17, 19,  1,  9}, /* U+00BC ¼ */
+  { 1472, 17, 17, 19,  1,  9}, /* U+00BD ½ */
+  { 1499, 18, 17, 20,  1,  9}, /* U+00BE ¾ */
+  { 1531,  9, 17, 11,  1, 13}, /* U+00BF ¿ */
+  { 1545, 15, 23, 15,  0,  3}, /* U+00C0 À */
+  { 1569, 15, 23, 15,  0,  3}, /* U+00C1 Á */
+  { 1593, 15, 23, 15,  0,  3}, /* U+00C2 Â */
+  { 1620, 15, 21, 15,  0,  5}, /* U+00C3 Ã */
+  { 1643, 15, 21, 15,  0,  5}, /* U+00C4 Ä */
+  { 1666, 16, 21, 16,  0,  5}, /* U+00C5 Å */
+  { 1691, 20, 17, 21,  0,  9}, /* U+00C6 Æ */
+  { 1713, 13, 23, 15,  1,  9}, /* U+00C7 Ç */
+  { 1734, 10, 23, 13,  2,  3}, /* U+00C8 È */
+  { 1747, 10, 23, 13,  2,  3}, /* U+00C9 É */
+  { 1760, 10, 23, 13,  2,  3}, /* U+00CA Ê */
+  { 1775, 10, 21, 13,  2,  5}, /* U+00CB Ë */
+  { 1786,  6, 23,  8,  1,  3}, /* U+00CC Ì */
+  { 1797,  6, 23,  8,  1,  3}, /* U+00CD Í */
+  { 1807,  8, 23,  8,  0,  3}, /* U+00CE Î */
+  { 1821,  7, 21,  9,  1,  5}, /* U+00CF Ï */
+  { 1831, 15, 17, 17,  1,  9}, /* U+00D0 Ð */
+  { 1849, 14, 21, 18,  2,  5}, /* U+00D1 Ñ */
+  { 1871, 16, 23, 18,  1,  3}, /* U+00D2 Ò */
+  { 1896, 16, 23, 18,  1,  3}, /* U+00D3 Ó */
+  { 1921, 16, 23, 18,  1,  3}, /* U+00D4 Ô */
+  { 1948, 16, 22, 18,  1,  4}, /* U+00D5 Õ */
+  { 1974, 16, 21, 18,  1,  5}, /* U+00D6 Ö */
+  { 1996, 10, 10, 14,  2, 13}, /* U+00D7 × */
+  { 2011, 16, 17, 18,  1,  9}, /* U+00D8 Ø */
+  { 2037, 13, 23, 17,  2,  3}, /* U+00D9 Ù */
+  { 2053, 13, 23, 17,  2,  3}, /* U+00DA Ú */
+  { 2069, 13, 23, 17,  2,  3}, /* U+00DB Û */
+  { 2086, 13, 21, 17,  2,  5}, /* U+00DC Ü */
+  { 2099, 12, 23, 14,  1,  3}, /* U+00DD Ý */
+  { 2119, 11, 17, 14,  2,  9}, /* U+00DE Þ */
+  { 2132, 12, 18, 15,  2,  8}, /* U+00DF ß */
+  { 2151, 10, 18, 13,  1,  8}, /* U+00E0 à */
+  { 2168, 10, 18, 13,  1,  8}, /* U+00E1 á */
+  { 2185, 10, 18, 13,  1,  8}, /* U+00E2 â */
+  { 2204, 10, 17, 13,  1,  9}, /* U+00E3 ã */
+  { 2221, 10, 17, 13,  1,  9}, /* U+00E4 ä */
+  { 2237, 10, 19, 13,  1,  7}, /* U+00E5 å */
+  { 2254, 18, 13, 20,  1, 13}, /* U+00E6 æ */
+  { 2276,  9, 19, 11,  1, 13}, /* U+00E7 ç */
+  { 2292, 11, 18, 13,  1,  8}, /* U+00E8 è */
+  { 2312, 11, 18, 13,  1,  8}, /* U+00E9 é */
+  { 2332, 11, 18, 13,  1,  8}, /* U+00EA ê */
+  { 2354, 11, 17, 13,  1,  9}, /* U+00EB ë */
+  { 2372,  4, 18,  6,  0,  8}, /* U+00EC ì */
+  { 2377,  4, 18,  6,  2,  8}, /* U+00ED í */
+  { 2382,  8, 18,  6, -1,  8}, /* U+00EE î */
+  { 2390,  6, 17,  6,  0,  9}, /* U+00EF ï */
+  { 2395, 12, 18, 14,  1,  8}, /* U+00F0 ð */
+  { 2418, 11, 17, 15,  2,  9}, /* U+00F1 ñ */
+  { 2430, 12, 18, 14,  1,  8}, /* U+00F2 ò */
+  { 2449, 12, 18, 14,  1,  8}, /* U+00F3 ó */
+  { 2469, 12, 18, 14,  1,  8}, /* U+00F4 ô */
+  { 2490, 12, 17, 14,  1,  9}, /* U+00F5 õ */
+  { 2509, 12, 17, 14,  1,  9}, /* U+00F6 ö */
+  { 2526, 11, 11, 13,  1, 12}, /* U+00F7 ÷ */
+  { 2533, 12, 13, 14,  1, 13}, /* U+00F8 ø */
+  { 2549, 11, 18, 15,  2,  8}, /* U+00F9 ù */
+  { 2561, 11, 18, 15,  2,  8}, /* U+00FA ú */
+  { 2573, 11, 18, 15,  2,  8}, /* U+00FB û */
+  { 2586, 11, 17, 15,  2,  9}, /* U+00FC ü */
+  { 2597, 12, 24, 12,  0,  8}, /* U+00FD ý */
+  { 2620, 11, 24, 14,  2,  8}, /* U+00FE þ */
+  { 2635, 13, 23, 13,  0,  9}, /* U+00FF ÿ */
+  { 2658, 15,  3, 19,  2, 23}, /* U+2026 … */
+};
+
+static const pRANGE FontNoto24_Ranges[] = {
+  {0x0020,  95,   0},
+  {0x00A0,  96,  95},
+  {0x2026,   1, 191},
+};
+
+static const pKERN FontNoto24_Kerning[] = {
+  {  2,  33, -2}, /* '"' 'A' */
+  {  2,  65, -1}, /* '"' 'a' */
+  {  2,  67, -1}, /* '"' 'c' */
+  {  2,  68, -1}, /* '"' 'd' */
+  {  2,  69, -1}, /* '"' 'e' */
+  {  2,  71, -1}, /* '"' 'g' */
+  {  2,  77, -1}, /* '"' 'm' */
+  {  2,  78, -1}, /* '"' 'n' */
+  {  2,  79, -1}, /* '"' 'o' */
+  {  2,  80, -1}, /* '"' 'p' */
+  {  2,  81, -1}, /* '"' 'q' */
+  {  2,  82, -1}, /* '"' 'r' */
+  {  2,  83, -1}, /* '"' 's' */
+  {  2,  85, -1}, /* '"' 'u' */
+  {  2, 127, -2}, /* '"' U+00C0 À */
+  {  2, 128, -2}, /* '"' U+00C1 Á */
+  {  2, 129, -2}, /* '"' U+00C2 Â */
+  {  2, 130, -2}, /* '"' U+00C3 Ã */
+  {  2, 131, -2}, /* '"' U+00C4 Ä */
+  {  2, 132, -2}, /* '"' U+00C5 Å */
+  {  2, 133, -2}, /* '"' U+00C6 Æ */
+  {  2, 159, -1}, /* '"' U+00E0 à */
+  {  2, 160, -1}, /* '"' U+00E1 á */
+  {  2, 161, -1}, /* '"' U+00E2 â */
+  {  2, 162, -1}, /* '"' U+00E3 ã */
+  {  2, 163, -1}, /* '"' U+00E4 ä */
+  {  2, 164, -1}, /* '"' U+00E5 å */
+  {  2, 165, -1}, /* '"' U+00E6 æ */
+  {  2, 166, -1}, /* '"' U+00E7 ç */
+  {  2, 167, -1}, /* '"' U+00E8 è */
+  {  2, 168, -1}, /* '"' U+00E9 é */
+  {  2, 169, -1}, /* '"' U+00EA ê */
+  {  2, 170, -1}, /* '"' U+00EB ë */
+  {  2, 177, -1}, /* '"' U+00F2 ò */
+  {  2, 178, -1}, /* '"' U+00F3 ó */
+  {  2, 179, -1}, /* '"' U+00F4 ô */
+  {  2, 180, -1}, /* '"' U+00F5 õ */
+  {  2, 181, -1}, /* '"' U+00F6 ö */
+  {  2, 183, -1}, /* '"' U+00F8 ø */
+  {  2, 184, -1}, /* '"' U+00F9 ù */
+  {  2, 185, -1}, /* '"' U+00FA ú */
+  {  2, 186, -1}, /* '"' U+00FB û */
+  {  2, 187, -1}, /* '"' U+00FC ü */
+  {  6,  52, -1}, /* '&' 'T' */
+  {  6,  57, -1}, /* '&' 'Y' */
+  {  6, 156, -1}, /* '&' U+00DD Ý */
+  {  7,  33, -2}, /* '\'' 'A' */
+  {  7,  65, -1}, /* '\'' 'a' */
+  {  7,  67, -1}, /* '\'' 'c' */
+  {  7,  68, -1}, /* '\'' 'd' */
+  {  7,  69, -1}, /* '\'' 'e' */
+  {  7,  71, -1}, /* '\'' 'g' */
+  {  7,  77, -1}, /* '\'' 'm' */
+  {  7,  78, -1}, /* '\'' 'n' */
+  {  7,  79, -1}, /* '\'' 'o' */
+  {  7,  80, -1}, /* '\'' 'p' */
+  {  7,  81, -1}, /* '\'' 'q' */
+  {  7,  82, -1}, /* '\'' 'r' */
+  {  7,  83, -1}, /* '\'' 's' */
+  {  7,  85, -1}, /* '\'' 'u' */
+  {  7, 127, -2}, /* '\'' U+00C0 À */
+  {  7, 128, -2}, /* '\'' U+00C1 Á */
+  {  7, 129, -2}, /* '\'' U+00C2 Â */
+  {  7, 130, -2}, /* '\'' U+00C3 Ã */
+  {  7, 131, -2}, /* '\'' U+00C4 Ä */
+  {  7, 132, -2}, /* '\'' U+00C5 Å */
+  {  7, 133, -2}, /* '\'' U+00C6 Æ */
+  {  7, 159, -1}, /* '\'' U+00E0 à */
+  {  7, 160, -1}, /* '\'' U+00E1 á */
+  {  7, 161, -1}, /* '\'' U+00E2 â */
+  {  7, 162, -1}, /* '\'' U+00E3 ã */
+  {  7, 163, -1}, /* '\'' U+00E4 ä */
+  {  7, 164, -1}, /* '\'' U+00E5 å */
+  {  7, 165, -1}, /* '\'' U+00E6 æ */
+  {  7, 166, -1}, /* '\'' U+00E7 ç */
+  {  7, 167, -1}, /* '\'' U+00E8 è */
+  {  7, 168, -1}, /* '\'' U+00E9 é */
+  {  7, 169, -1}, /* '\'' U+00EA ê */
+  {  7, 170, -1}, /* '\'' U+00EB ë */
+  {  7, 177, -1}, /* '\'' U+00F2 ò */
+  {  7, 178, -1}, /* '\'' U+00F3 ó */
+  {  7, 179, -1}, /* '\'' U+00F4 ô */
+  {  7, 180, -1}, /* '\'' U+00F5 õ */
+  {  7, 181, -1}, /* '\'' U+00F6 ö */
+  {  7, 183, -1}, /* '\'' U+00F8 ø */
+  {  7, 184, -1}, /* '\'' U+00F9 ù */
+  {  7, 185, -1}, /* '\'' U+00FA ú */
+  {  7, 186, -1}, /* '\'' U+00FB û */
+  {  7, 187, -1}, /* '\'' U+00FC ü */
+  {  8,  42,  2}, /* '(' 'J' */
+  {  8,  74,  1}, /* '(' 'j' */
+  { 12,  35, -1}, /* ',' 'C' */
+  { 12,  39, -1}, /* ',' 'G' */
+  { 12,  47, -1}, /* ',' 'O' */
+  { 12,  49, -1}, /* ',' 'Q' */
+  { 12,  52, -2}, /* ',' 'T' */
+  { 12,  54, -1}, /* ',' 'V' */
+  { 12,  55, -1}, /* ',' 'W' */
+  { 12,  57, -1}, /* ',' 'Y' */
+  { 12, 134, -1}, /* ',' U+00C7 Ç */
+  { 12, 145, -1}, /* ',' U+00D2 Ò */
+  { 12, 146, -1}, /* ',' U+00D3 Ó */
+  { 12, 147, -1}, /* ',' U+00D4 Ô */
+  { 12, 148, -1}, /* ',' U+00D5 Õ */
+  { 12, 149, -1}, /* ',' U+00D6 Ö */
+  { 12, 151, -1}, /* ',' U+00D8 Ø */
+  { 12, 156, -1}, /* ',' U+00DD Ý */
+  { 13,  52, -1}, /* '-' 'T' */
+  { 14,  35, -1}, /* '.' 'C' */
+  { 14,  39, -1}, /* '.' 'G' */
+  { 14,  47, -1}, /* '.' 'O' */
+  { 14,  49, -1}, /* '.' 'Q' */
+  { 14,  52, -2}, /* '.' 'T' */
+  { 14,  54, -1}, /* '.' 'V' */
+  { 14,  55, -1}, /* '.' 'W' */
+  { 14,  57, -1}, /* '.' 'Y' */
+  { 14, 134, -1}, /* '.' U+00C7 Ç */
+  { 14, 145, -1}, /* '.' U+00D2 Ò */
+  { 14, 146, -1}, /* '.' U+00D3 Ó */
+  { 14, 147, -1}, /* '.' U+00D4 Ô */
+  { 14, 148, -1}, /* '.' U+00D5 Õ */
+  { 14, 149, -1}, /* '.' U+00D6 Ö */
+  { 14, 151, -1}, /* '.' U+00D8 Ø */
+  { 14, 156, -1}, /* '.' U+00DD Ý */
+  { 33,   2, -2}, /* 'A' '"' */
+  { 33,   7, -2}, /* 'A' '\'' */
+  { 33,  42,  1}, /* 'A' 'J' */
+  { 33,  52, -2}, /* 'A' 'T' */
+  { 33,  54, -1}, /* 'A' 'V' */
+  { 33,  55, -1}, /* 'A' 'W' */
+  { 33,  57, -1}, /* 'A' 'Y' */
+  { 33, 156, -1}, /* 'A' U+00DD Ý */
+  { 36,  12, -1}, /* 'D' ',' */
+  { 36,  14, -1}, /* 'D' '.' */
+  { 36,  52, -1}, /* 'D' 'T' */
+  { 36, 191, -1}, /* 'D' U+2026 … */
+  { 37,  42,  1}, /* 'E' 'J' */
+  { 38,  12, -1}, /* 'F' ',' */
+  { 38,  14, -1}, /* 'F' '.' */
+  { 38, 191, -1}, /* 'F' U+2026 … */
+  { 44,   2, -2}, /* 'L' '"' */
+  { 44,   7, -2}, /* 'L' '\'' */
+  { 44,  57, -1}, /* 'L' 'Y' */
+  { 44, 156, -1}, /* 'L' U+00DD Ý */
+  { 47,  12, -1}, /* 'O' ',' */
+  { 47,  14, -1}, /* 'O' '.' */
+  { 47,  52, -1}, /* 'O' 'T' */
+  { 47, 191, -1}, /* 'O' U+2026 … */
+  { 48,  12, -3}, /* 'P' ',' */
+  { 48,  14, -3}, /* 'P' '.' */
+  { 48,  33, -1}, /* 'P' 'A' */
+  { 48, 127, -1}, /* 'P' U+00C0 À */
+  { 48, 128, -1}, /* 'P' U+00C1 Á */
+  { 48, 129, -1}, /* 'P' U+00C2 Â */
+  { 48, 130, -1}, /* 'P' U+00C3 Ã */
+  { 48, 131, -1}, /* 'P' U+00C4 Ä */
+  { 48, 132, -1}, /* 'P' U+00C5 Å */
+  { 48, 133, -1}, /* 'P' U+00C6 Æ */
+  { 48, 191, -3}, /* 'P' U+2026 … */
+  { 49,  12, -1}, /* 'Q' ',' */
+  { 49,  14, -1}, /* 'Q' '.' */
+  { 49,  52, -1}, /* 'Q' 'T' */
+  { 49, 191, -1}, /* 'Q' U+2026 … */
+  { 52,  12, -1}, /* 'T' ',' */
+  { 52,  13, -1}, /* 'T' '-' */
+  { 52,  14, -1}, /* 'T' '.' */
+  { 52,  33, -2}, /* 'T' 'A' */
+  { 52,  65, -2}, /* 'T' 'a' */
+  { 52,  67, -2}, /* 'T' 'c' */
+  { 52,  68, -2}, /* 'T' 'd' */
+  { 52,  69, -2}, /* 'T' 'e' */
+  { 52,  71, -2}, /* 'T' 'g' */
+  { 52,  77, -1}, /* 'T' 'm' */
+  { 52,  78, -1}, /* 'T' 'n' */
+  { 52,  79, -2}, /* 'T' 'o' */
+  { 52,  80, -1}, /* 'T' 'p' */
+  { 52,  81, -2}, /* 'T' 'q' */
+  { 52,  82, -1}, /* 'T' 'r' */
+  { 52,  83, -1}, /* 'T' 's' */
+  { 52,  85, -1}, /* 'T' 'u' */
+  { 52,  90, -1}, /* 'T' 'z' */
+  { 52, 106, -1}, /* 'T' U+00AB « */
+  { 52, 122, -1}, /* 'T' U+00BB » */
+  { 52, 127, -2}, /* 'T' U+00C0 À */
+  { 52, 128, -2}, /* 'T' U+00C1 Á */
+  { 52, 129, -2}, /* 'T' U+00C2 Â */
+  { 52, 130, -2}, /* 'T' U+00C3 Ã */
+  { 52, 131, -2}, /* 'T' U+00C4 Ä */
+  { 52, 132, -2}, /* 'T' U+00C5 Å */
+  { 52, 159, -2}, /* 'T' U+00E0 à */
+  { 52, 160, -2}, /* 'T' U+00E1 á */
+  { 52, 161, -2}, /* 'T' U+00E2 â */
+  { 52, 162, -2}, /* 'T' U+00E3 ã */
+  { 52, 163, -2}, /* 'T' U+00E4 ä */
+  { 52, 164, -2}, /* 'T' U+00E5 å */
+  { 52, 165, -2}, /* 'T' U+00E6 æ */
+  { 52, 166, -2}, /* 'T' U+00E7 ç */
+  { 52, 167, -2}, /* 'T' U+00E8 è */
+  { 52, 168, -2}, /* 'T' U+00E9 é */
+  { 52, 169, -2}, /* 'T' U+00EA ê */
+  { 52, 170, -2}, /* 'T' U+00EB ë */
+  { 52, 177, -2}, /* 'T' U+00F2 ò */
+  { 52, 178, -2}, /* 'T' U+00F3 ó */
+  { 52, 179, -2}, /* 'T' U+00F4 ô */
+  { 52, 180, -2}, /* 'T' U+00F5 õ */
+  { 52, 181, -2}, /* 'T' U+00F6 ö */
+  { 52, 183, -2}, /* 'T' U+00F8 ø */
+  { 52, 184, -1}, /* 'T' U+00F9 ù */
+  { 52, 185, -1}, /* 'T' U+00FA ú */
+  { 52, 186, -1}, /* 'T' U+00FB û */
+  { 52, 187, -1}, /* 'T' U+00FC ü */
+  { 52, 191, -1}, /* 'T' U+2026 … */
+  { 54,  12, -1}, /* 'V' ',' */
+  { 54,  14, -1}, /* 'V' '.' */
+  { 54,  33, -1}, /* 'V' 'A' */
+  { 54, 106, -1}, /* 'V' U+00AB « */
+  { 54, 127, -1}, /* 'V' U+00C0 À */
+  { 54, 128, -1}, /* 'V' U+00C1 Á */
+  { 54, 129, -1}, /* 'V' U+00C2 Â */
+  { 54, 130, -1}, /* 'V' U+00C3 Ã */
+  { 54, 131, -1}, /* 'V' U+00C4 Ä */
+  { 54, 132, -1}, /* 'V' U+00C5 Å */
+  { 54, 191, -1}, /* 'V' U+2026 … */
+  { 55,  12, -1}, /* 'W' ',' */
+  { 55,  14, -1}, /* 'W' '.' */
+  { 55,  33, -1}, /* 'W' 'A' */
+  { 55, 106, -1}, /* 'W' U+00AB « */
+  { 55, 127, -1}, /* 'W' U+00C0 À */
+  { 55, 128, -1}, /* 'W' U+00C1 Á */
+  { 55, 129, -1}, /* 'W' U+00C2 Â */
+  { 55, 130, -1}, /* 'W' U+00C3 Ã */
+  { 55, 131, -1}, /* 'W' U+00C4 Ä */
+  { 55, 132, -1}, /* 'W' U+00C5 Å */
+  { 55, 191, -1}, /* 'W' U+2026 … */
+  { 57,   6, -1}, /* 'Y' '&' */
+  { 57,  12, -1}, /* 'Y' ',' */
+  { 57,  14, -1}, /* 'Y' '.' */
+  { 57,  33, -1}, /* 'Y' 'A' */
+  { 57,  65, -1}, /* 'Y' 'a' */
+  { 57,  67, -1}, /* 'Y' 'c' */
+  { 57,  68, -1}, /* 'Y' 'd' */
+  { 57,  69, -1}, /* 'Y' 'e' */
+  { 57,  71, -1}, /* 'Y' 'g' */
+  { 57,  77, -1}, /* 'Y' 'm' */
+  { 57,  78, -1}, /* 'Y' 'n' */
+  { 57,  79, -1}, /* 'Y' 'o' */
+  { 57,  80, -1}, /* 'Y' 'p' */
+  { 57,  81, -1}, /* 'Y' 'q' */
+  { 57,  82, -1}, /* 'Y' 'r' */
+  { 57,  83, -1}, /* 'Y' 's' */
+  { 57,  85, -1}, /* 'Y' 'u' */
+  { 57, 106, -2}, /* 'Y' U+00AB « */
+  { 57, 122, -1}, /* 'Y' U+00BB » */
+  { 57, 127, -1}, /* 'Y' U+00C0 À */
+  { 57, 128, -1}, /* 'Y' U+00C1 Á */
+  { 57, 129, -1}, /* 'Y' U+00C2 Â */
+  { 57, 130, -1}, /* 'Y' U+00C3 Ã */
+  { 57, 131, -1}, /* 'Y' U+00C4 Ä */
+  { 57, 132, -1}, /* 'Y' U+00C5 Å */
+  { 57, 159, -1}, /* 'Y' U+00E0 à */
+  { 57, 160, -1}, /* 'Y' U+00E1 á */
+  { 57, 161, -1}, /* 'Y' U+00E2 â */
+  { 57, 162, -1}, /* 'Y' U+00E3 ã */
+  { 57, 163, -1}, /* 'Y' U+00E4 ä */
+  { 57, 164, -1}, /* 'Y' U+00E5 å */
+  { 57, 165, -1}, /* 'Y' U+00E6 æ */
+  { 57, 166, -1}, /* 'Y' U+00E7 ç */
+  { 57, 167, -1}, /* 'Y' U+00E8 è */
+  { 57, 168, -1}, /* 'Y' U+00E9 é */
+  { 57, 169, -1}, /* 'Y' U+00EA ê */
+  { 57, 170, -1}, /* 'Y' U+00EB ë */
+  { 57, 177, -1}, /* 'Y' U+00F2 ò */
+  { 57, 178, -1}, /* 'Y' U+00F3 ó */
+  { 57, 179, -1}, /* 'Y' U+00F4 ô */
+  { 57, 180, -1}, /* 'Y' U+00F5 õ */
+  { 57, 181, -1}, /* 'Y' U+00F6 ö */
+  { 57, 183, -1}, /* 'Y' U+00F8 ø */
+  { 57, 184, -1}, /* 'Y' U+00F9 ù */
+  { 57, 185, -1}, /* 'Y' U+00FA ú */
+  { 57, 186, -1}, /* 'Y' U+00FB û */
+  { 57, 187, -1}, /* 'Y' U+00FC ü */
+  { 57, 191, -1}, /* 'Y' U+2026 … */
+  { 59,  42,  2}, /* '[' 'J' */
+  { 59,  74,  1}, /* '[' 'j' */
+  { 63,  42,  2}, /* '_' 'J' */
+  { 70,   2,  1}, /* 'f' '"' */
+  { 70,   7,  1}, /* 'f' '\'' */
+  { 70,   9,  1}, /* 'f' ')' */
+  { 70,  61,  1}, /* 'f' ']' */
+  { 70,  93,  1}, /* 'f' '}' */
+  { 82,   2,  1}, /* 'r' '"' */
+  { 82,   7,  1}, /* 'r' '\'' */
+  { 82,  12, -4}, /* 'r' ',' */
+  { 82,  14, -4}, /* 'r' '.' */
+  { 82, 191, -4}, /* 'r' U+2026 … */
+  { 86,   2,  1}, /* 'v' '"' */
+  { 86,   7,  1}, /* 'v' '\'' */
+  { 86,  12, -1}, /* 'v' ',' */
+  { 86,  14, -1}, /* 'v' '.' */
+  { 86, 191, -1}, /* 'v' U+2026 … */
+  { 87,   2,  1}, /* 'w' '"' */
+  { 87,   7,  1}, /* 'w' '\'' */
+  { 87,  12, -1}, /* 'w' ',' */
+  { 87,  14, -1}, /* 'w' '.' */
+  { 87, 191, -1}, /* 'w' U+2026 … */
+  { 89,   2,  1}, /* 'y' '"' */
+  { 89,   7,  1}, /* 'y' '\'' */
+  { 89,  12, -1}, /* 'y' ',' */
+  { 89,  14, -1}, /* 'y' '.' */
+  { 89, 191, -1}, /* 'y' U+2026 … */
+  { 91,  42,  2}, /* '{' 'J' */
+  { 91,  74,  1}, /* '{' 'j' */
+  { 96,  42,  1}, /* U+00A1 ¡ 'J' */
+  { 96,  57, -1}, /* U+00A1 ¡ 'Y' */
+  { 96, 156, -1}, /* U+00A1 ¡ U+00DD Ý */
+  {106,  52, -1}, /* U+00AB « 'T' */
+  {106,  57, -1}, /* U+00AB « 'Y' */
+  {106, 156, -1}, /* U+00AB « U+00DD Ý */
+  {122,  52, -1}, /* U+00BB » 'T' */
+  {122,  54, -1}, /* U+00BB » 'V' */
+  {122,  55, -1}, /* U+00BB » 'W' */
+  {122,  57, -2}, /* U+00BB » 'Y' */
+  {122, 156, -2}, /* U+00BB » U+00DD Ý */
+  {126,  42,  2}, /* U+00BF ¿ 'J' */
+  {126,  52, -1}, /* U+00BF ¿ 'T' */
+  {126,  54, -1}, /* U+00BF ¿ 'V' */
+  {126,  55, -1}, /* U+00BF ¿ 'W' */
+  {126,  57, -1}, /* U+00BF ¿ 'Y' */
+  {126, 156, -1}, /* U+00BF ¿ U+00DD Ý */
+  {127,   2, -2}, /* U+00C0 À '"' */
+  {127,   7, -2}, /* U+00C0 À '\'' */
+  {127,  42,  1}, /* U+00C0 À 'J' */
+  {127,  52, -2}, /* U+00C0 À 'T' */
+  {127,  54, -1}, /* U+00C0 À 'V' */
+  {127,  55, -1}, /* U+00C0 À 'W' */
+  {127,  57, -1}, /* U+00C0 À 'Y' */
+  {127, 156, -1}, /* U+00C0 À U+00DD Ý */
+  {128,   2, -2}, /* U+00C1 Á '"' */
+  {128,   7, -2}, /* U+00C1 Á '\'' */
+  {128,  42,  1}, /* U+00C1 Á 'J' */
+  {128,  52, -2}, /* U+00C1 Á 'T' */
+  {128,  54, -1}, /* U+00C1 Á 'V' */
+  {128,  55, -1}, /* U+00C1 Á 'W' */
+  {128,  57, -1}, /* U+00C1 Á 'Y' */
+  {128, 156, -1}, /* U+00C1 Á U+00DD Ý */
+  {129,   2, -2}, /* U+00C2 Â '"' */
+  {129,   7, -2}, /* U+00C2 Â '\'' */
+  {129,  42,  1}, /* U+00C2 Â 'J' */
+  {129,  52, -2}, /* U+00C2 Â 'T' */
+  {129,  54, -1}, /* U+00C2 Â 'V' */
+  {129,  55, -1}, /* U+00C2 Â 'W' */
+  {129,  57, -1}, /* U+00C2 Â 'Y' */
+  {129, 156, -1}, /* U+00C2 Â U+00DD Ý */
+  {130,   2, -2}, /* U+00C3 Ã '"' */
+  {130,   7, -2}, /* U+00C3 Ã '\'' */
+  {130,  42,  1}, /* U+00C3 Ã 'J' */
+  {130,  52, -2}, /* U+00C3 Ã 'T' */
+  {130,  54, -1}, /* U+00C3 Ã 'V' */
+  {130,  55, -1}, /* U+00C3 Ã 'W' */
+  {130,  57, -1}, /* U+00C3 Ã 'Y' */
+  {130, 156, -1}, /* U+00C3 Ã U+00DD Ý */
+  {131,   2, -2}, /* U+00C4 Ä '"' */
+  {131,   7, -2}, /* U+00C4 Ä '\'' */
+  {131,  42,  1}, /* U+00C4 Ä 'J' */
+  {131,  52, -2}, /* U+00C4 Ä 'T' */
+  {131,  54, -1}, /* U+00C4 Ä 'V' */
+  {131,  55, -1}, /* U+00C4 Ä 'W' */
+  {131,  57, -1}, /* U+00C4 Ä 'Y' */
+  {131, 156, -1}, /* U+00C4 Ä U+00DD Ý */
+  {132,   2, -2}, /* U+00C5 Å '"' */
+  {132,   7, -2}, /* U+00C5 Å '\'' */
+  {132,  42,  1}, /* U+00C5 Å 'J' */
+  {132,  52, -2}, /* U+00C5 Å 'T' */
+  {132,  54, -1}, /* U+00C5 Å 'V' */
+  {132,  55, -1}, /* U+00C5 Å 'W' */
+  {132,  57, -1}, /* U+00C5 Å 'Y' */
+  {132, 156, -1}, /* U+00C5 Å U+00DD Ý */
+  {133,  42,  1}, /* U+00C6 Æ 'J' */
+  {135,  42,  1}, /* U+00C8 È 'J' */
+  {136,  42,  1}, /* U+00C9 É 'J' */
+  {137,  42,  1}, /* U+00CA Ê 'J' */
+  {138,  42,  1}, /* U+00CB Ë 'J' */
+  {143,  12, -1}, /* U+00D0 Ð ',' */
+  {143,  14, -1}, /* U+00D0 Ð '.' */
+  {143,  52, -1}, /* U+00D0 Ð 'T' */
+  {143, 191, -1}, /* U+00D0 Ð U+2026 … */
+  {145,  12, -1}, /* U+00D2 Ò ',' */
+  {145,  14, -1}, /* U+00D2 Ò '.' */
+  {145,  52, -1}, /* U+00D2 Ò 'T' */
+  {145, 191, -1}, /* U+00D2 Ò U+2026 … */
+  {146,  12, -1}, /* U+00D3 Ó ',' */
+  {146,  14, -1}, /* U+00D3 Ó '.' */
+  {146,  52, -1}, /* U+00D3 Ó 'T' */
+  {146, 191, -1}, /* U+00D3 Ó U+2026 … */
+  {147,  12, -1}, /* U+00D4 Ô ',' */
+  {147,  14, -1}, /* U+00D4 Ô '.' */
+  {147,  52, -1}, /* U+00D4 Ô 'T' */
+  {147, 191, -1}, /* U+00D4 Ô U+2026 … */
+  {148,  12, -1}, /* U+00D5 Õ ',' */
+  {148,  14, -1}, /* U+00D5 Õ '.' */
+  {148,  52, -1}, /* U+00D5 Õ 'T' */
+  {148, 191, -1}, /* U+00D5 Õ U+2026 … */
+  {149,  12, -1}, /* U+00D6 Ö ',' */
+  {149,  14, -1}, /* U+00D6 Ö '.' */
+  {149,  52, -1}, /* U+00D6 Ö 'T' */
+  {149, 191, -1}, /* U+00D6 Ö U+2026 … */
+  {151,  12, -1}, /* U+00D8 Ø ',' */
+  {151,  14, -1}, /* U+00D8 Ø '.' */
+  {151,  52, -1}, /* U+00D8 Ø 'T' */
+  {151, 191, -1}, /* U+00D8 Ø U+2026 … */
+  {156,   6, -1}, /* U+00DD Ý '&' */
+  {156,  12, -1}, /* U+00DD Ý ',' */
+  {156,  14, -1}, /* U+00DD Ý '.' */
+  {156,  33, -1}, /* U+00DD Ý 'A' */
+  {156,  65, -1}, /* U+00DD Ý 'a' */
+  {156,  67, -1}, /* U+00DD Ý 'c' */
+  {156,  68, -1}, /* U+00DD Ý 'd' */
+  {156,  69, -1}, /* U+00DD Ý 'e' */
+  {156,  71, -1}, /* U+00DD Ý 'g' */
+  {156,  77, -1}, /* U+00DD Ý 'm' */
+  {156,  78, -1}, /* U+00DD Ý 'n' */
+  {156,  79, -1}, /* U+00DD Ý 'o' */
+  {156,  80, -1}, /* U+00DD Ý 'p' */
+  {156,  81, -1}, /* U+00DD Ý 'q' */
+  {156,  82, -1}, /* U+00DD Ý 'r' */
+  {156,  83, -1}, /* U+00DD Ý 's' */
+  {156,  85, -1}, /* U+00DD Ý 'u' */
+  {156, 106, -2}, /* U+00DD Ý U+00AB « */
+  {156, 122, -1}, /* U+00DD Ý U+00BB » */
+  {156, 127, -1}, /* U+00DD Ý U+00C0 À */
+  {156, 128, -1}, /* U+00DD Ý U+00C1 Á */
+  {156, 129, -1}, /* U+00DD Ý U+00C2 Â */
+  {156, 130, -1}, /* U+00DD Ý U+00C3 Ã */
+  {156, 131, -1}, /* U+00DD Ý U+00C4 Ä */
+  {156, 132, -1}, /* U+00DD Ý U+00C5 Å */
+  {156, 159, -1}, /* U+00DD Ý U+00E0 à */
+  {156, 160, -1}, /* U+00DD Ý U+00E1 á */
+  {156, 161, -1}, /* U+00DD Ý U+00E2 â */
+  {156, 162, -1}, /* U+00DD Ý U+00E3 ã */
+  {156, 163, -1}, /* U+00DD Ý U+00E4 ä */
+  {156, 164, -1}, /* U+00DD Ý U+00E5 å */
+  {156, 165, -1}, /* U+00DD Ý U+00E6 æ */
+  {156, 166, -1}, /* U+00DD Ý U+00E7 ç */
+  {156, 167, -1}, /* U+00DD Ý U+00E8 è */
+  {156, 168, -1}, /* U+00DD Ý U+00E9 é */
+  {156, 169, -1}, /* U+00DD Ý U+00EA ê */
+  {156, 170, -1}, /* U+00DD Ý U+00EB ë */
+  {156, 177, -1}, /* U+00DD Ý U+00F2 ò */
+  {156, 178, -1}, /* U+00DD Ý U+00F3 ó */
+  {156, 179, -1}, /* U+00DD Ý U+00F4 ô */
+  {156, 180, -1}, /* U+00DD Ý U+00F5 õ */
+  {156, 181, -1}, /* U+00DD Ý U+00F6 ö */
+  {156, 183, -1}, /* U+00DD Ý U+00F8 ø */
+  {156, 184, -1}, /* U+00DD Ý U+00F9 ù */
+  {156, 185, -1}, /* U+00DD Ý U+00FA ú */
+  {156, 186, -1}, /* U+00DD Ý U+00FB û */
+  {156, 187, -1}, /* U+00DD Ý U+00FC ü */
+  {156, 191, -1}, /* U+00DD Ý U+2026 … */
+  {157,  12, -3}, /* U+00DE Þ ',' */
+  {157,  14, -3}, /* U+00DE Þ '.' */
+  {157,  33, -1}, /* U+00DE Þ 'A' */
+  {157, 127, -1}, /* U+00DE Þ U+00C0 À */
+  {157, 128, -1}, /* U+00DE Þ U+00C1 Á */
+  {157, 129, -1}, /* U+00DE Þ U+00C2 Â */
+  {157, 130, -1}, /* U+00DE Þ U+00C3 Ã */
+  {157, 131, -1}, /* U+00DE Þ U+00C4 Ä */
+  {157, 132, -1}, /* U+00DE Þ U+00C5 Å */
+  {157, 133, -1}, /* U+00DE Þ U+00C6 Æ */
+  {157, 191, -3}, /* U+00DE Þ U+2026 … */
+  {173,   9,  1}, /* U+00EE î ')' */
+  {173,  61,  1}, /* U+00EE î ']' */
+  {173,  93,  1}, /* U+00EE î '}' */
+  {174,   9,  1}, /* U+00EF ï ')' */
+  {174,  61,  1}, /* U+00EF ï ']' */
+  {174,  93,  1}, /* U+00EF ï '}' */
+  {188,   2,  1}, /* U+00FD ý '"' */
+  {188,   7,  1}, /* U+00FD ý '\'' */
+  {188,  12, -1}, /* U+00FD ý ',' */
+  {188,  14, -1}, /* U+00FD ý '.' */
+  {188, 191, -1}, /* U+00FD ý U+2026 … */
+  {190,   2,  1}, /* U+00FF ÿ '"' */
+  {190,   7,  1}, /* U+00FF ÿ '\'' */
+  {190,  12, -1}, /* U+00FF ÿ ',' */
+  {190,  14, -1}, /* U+00FF ÿ '.' */
+  {190, 191, -1}, /* U+00FF ÿ U+2026 … */
+};
+
+static const pHUFFMAN FontNoto24_Runs[2] = {
+  { /* white runs */
+    {0, 0, 1, 2, 3, 3, 7, 5, 10, 9, 8, 9, 6, 0, 0, 0},
+    { 1,  2,  3,  4,  5,  6,  7,  8, 10,  0,  9, 11, 12, 13, 14, 63,
+     15, 16, 17, 24, 30, 18, 19, 22, 23, 25, 26, 32, 33, 44, 48, 20,
+     21, 28, 36, 38, 41, 42, 43, 62, 27, 29, 34, 37, 45, 50, 56, 58,
+     31, 39, 40, 46, 47, 49, 52, 55, 60, 35, 51, 54, 57, 59, 61,  0},
+  },
+  { /* black runs */
+    {0, 1, 1, 0, 2, 2, 3, 1, 0, 2, 4, 0, 0, 0, 0, 0},
+    { 1,  2,  3,  4,  5,  6,  7,  8, 10,  9, 11, 22, 12, 15, 18, 20,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+  },
+};
+
+pFONT FontNoto24 = {
+  FontNoto24_Bitmap,
+  FontNoto24_Glyphs,
+  FontNoto24_Ranges,
+  sizeof(FontNoto24_Ranges) / sizeof(pRANGE),
+  FontNoto24_Kerning,
+  sizeof(FontNoto24_Kerning) / sizeof(pKERN),
+  33, /* Height */
+  26, /* Ascent */
+  FontNoto24_Runs,
+};
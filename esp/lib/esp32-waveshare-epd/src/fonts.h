@@ -68,6 +68,12 @@ typedef struct                                          // 汉字字模数据结
   const char matrix[MAX_HEIGHT_FONT*MAX_WIDTH_FONT/8];  // 点阵码数据
 }CH_CN;
 
+typedef struct                                          // CH_CN entries sorted by code, see font-index.py
+{
+  uint32_t code;                                        // Unicode code point
+  uint16_t entry;                                       // position in the CH_CN table
+}CH_CN_INDEX;
+
 typedef struct
 {    
   const CH_CN *table;
@@ -75,9 +81,55 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  const CH_CN_INDEX *index;  /* sorted by code, NULL to scan the table */
+  uint16_t index_size;
   
 }cFONT;
 
+//Proportional, see font-pack.py
+typedef struct
+{
+  uint16_t offset;    // first byte in the bitmap, rows follow without padding
+  uint8_t width;      // ink box
+  uint8_t height;
+  uint8_t advance;    // pen movement to the next glyph
+  int8_t left;        // ink box right of the pen
+  int8_t top;         // ink box below the top of the line
+}pGLYPH;
+
+typedef struct
+{
+  uint32_t first;     // first code point
+  uint16_t count;     // consecutive code points
+  uint16_t glyph;     // pGLYPH of the first code point
+}pRANGE;
+
+typedef struct
+{
+  uint16_t left;      // pGLYPH indexes, sorted by left then right
+  uint16_t right;
+  int8_t offset;      // added to the advance of left
+}pKERN;
+
+typedef struct
+{
+  uint8_t counts[16]; // canonical codes of each bit length, counts[0] unused
+  uint8_t symbols[64];// run lengths in code order, 63 adds 63 and reads on
+}pHUFFMAN;
+
+typedef struct
+{
+  const uint8_t *bitmap;
+  const pGLYPH *glyphs;
+  const pRANGE *ranges;
+  uint16_t range_count;
+  const pKERN *kerning;  /* NULL without kerning */
+  uint16_t kerning_count;
+  uint8_t Height;        // line height
+  uint8_t Ascent;        // baseline below the top of the line
+  const pHUFFMAN *runs;  /* white and black run codes, NULL when not compressed */
+}pFONT;
+
 extern sFONT Font24;
 extern sFONT Font20;
 extern sFONT Font16;
@@ -86,6 +138,9 @@ extern sFONT Font8;
 
 extern cFONT Font12CN;
 extern cFONT Font24CN;
+
+extern pFONT FontNoto16;
+extern pFONT FontNoto24;
 // extern const unsigned char Font16_Table[];
 
 #ifdef __cplusplus
@@ -16,7 +16,10 @@
 
 #include <Wire.h>
 
-#define USE_DEBUG 1
+// off by default, blocking serial prints in the drawing and busy wait paths stretch the awake time
+#ifndef USE_DEBUG
+#define USE_DEBUG 0
+#endif
 #if USE_DEBUG
 	#define Debug(__info) Serial.print(__info)
 #else
@@ -30,6 +30,8 @@
 ******************************************************************************/
 #include "EPD_7in5_V2.h"
 #include "Debug.h"
+#include "../GUI_Buffer.h"
+#include <string.h>
 
 /******************************************************************************
 function :	Software reset
@@ -86,10 +88,12 @@ parameter:
 static void EPD_WaitUntilIdle(void)
 {
     Debug("e-Paper busy\r\n");
+    DEV_Busy_Begin();
 	do{
 		DEV_Delay_ms(5);  
 	}while(!(DEV_Digital_Read(EPD_BUSY_PIN)));   
 	DEV_Delay_ms(5);      
+    DEV_Busy_End();
     Debug("e-Paper busy release\r\n");
 }
 /******************************************************************************
@@ -213,6 +217,94 @@ UBYTE EPD_7IN5_V2_Init_Part(void)
     return 0;
 }
 
+/******************************************************************************
+function :	Built-in waveforms for the register LUTs
+info:
+    A group is 6 bytes: the level of 4 phases, 2 bits each from the top
+    (00 VCOM_DC, 01 VDH toward black, 10 VDL toward white, 11 floating),
+    the frame count of each phase and how often the group repeats. All
+    LUTs of a waveform share the timing. WW and BB stay at VCOM_DC, so
+    unchanged pixels do not flash.
+    fast     : one short push, for clock ticks, leaves some ghosting
+    balanced : one full push
+    quality  : stronger drive, repeated, for text that changes rarely
+******************************************************************************/
+#define EPD_LUT_GROUP(Levels, T1, T2, T3, T4, Repeat) Levels, T1, T2, T3, T4, Repeat
+
+const EPD_7IN5_V2_LUT EPD_7IN5_V2_Luts[] = {
+    {
+        "fast",
+        {EPD_LUT_GROUP(0x00, 10, 2, 10, 2, 1)},
+        {EPD_LUT_GROUP(0x00, 10, 2, 10, 2, 1)},
+        {EPD_LUT_GROUP(0x48, 10, 2, 10, 2, 1)},     // VDH, -, VDL, -
+        {EPD_LUT_GROUP(0x84, 10, 2, 10, 2, 1)},     // VDL, -, VDH, -
+        {EPD_LUT_GROUP(0x00, 10, 2, 10, 2, 1)},
+    },
+    {
+        "balanced",
+        {EPD_LUT_GROUP(0x00, 30, 5, 30, 5, 1)},
+        {EPD_LUT_GROUP(0x00, 30, 5, 30, 5, 1)},
+        {EPD_LUT_GROUP(0x48, 30, 5, 30, 5, 1)},
+        {EPD_LUT_GROUP(0x84, 30, 5, 30, 5, 1)},
+        {EPD_LUT_GROUP(0x00, 30, 5, 30, 5, 1)},
+    },
+    {
+        "quality",
+        {EPD_LUT_GROUP(0x00, 30, 5, 30, 5, 2), EPD_LUT_GROUP(0x00, 10, 0, 0, 0, 1)},
+        {EPD_LUT_GROUP(0x00, 30, 5, 30, 5, 2), EPD_LUT_GROUP(0x00, 10, 0, 0, 0, 1)},
+        {EPD_LUT_GROUP(0x5A, 30, 5, 30, 5, 2), EPD_LUT_GROUP(0x80, 10, 0, 0, 0, 1)},   // VDH, VDH, VDL, VDL, then VDL
+        {EPD_LUT_GROUP(0xA5, 30, 5, 30, 5, 2), EPD_LUT_GROUP(0x40, 10, 0, 0, 0, 1)},   // VDL, VDL, VDH, VDH, then VDH
+        {EPD_LUT_GROUP(0x00, 30, 5, 30, 5, 2), EPD_LUT_GROUP(0x00, 10, 0, 0, 0, 1)},
+    },
+};
+const UBYTE EPD_7IN5_V2_LutCount = sizeof(EPD_7IN5_V2_Luts) / sizeof(EPD_7IN5_V2_Luts[0]);
+
+/******************************************************************************
+function :	Look up a built-in waveform
+parameter:
+    Name : Name of the waveform
+info:
+    Returns NULL for unknown names, the panel then keeps its OTP waveform.
+******************************************************************************/
+const EPD_7IN5_V2_LUT *EPD_7IN5_V2_Find_Lut(const char *Name)
+{
+    for (UBYTE i = 0; i < EPD_7IN5_V2_LutCount; i++) {
+        if (strcmp(EPD_7IN5_V2_Luts[i].Name, Name) == 0)
+            return &EPD_7IN5_V2_Luts[i];
+    }
+    return NULL;
+}
+
+static void EPD_7IN5_V2_SendLut(UBYTE Reg, const UBYTE *Lut)
+{
+    UBYTE data[EPD_7IN5_V2_LUT_SIZE];
+
+    memset(data, 0x00, sizeof(data));
+    memcpy(data, Lut, EPD_7IN5_V2_LUT_GROUPS * 6);
+    EPD_SendCommand(Reg);
+    EPD_SendData2(data, sizeof(data));
+}
+
+/******************************************************************************
+function :	Refresh with a waveform from registers instead of the OTP
+parameter:
+    Lut : Waveform, built-in or custom
+info:
+    Call after EPD_7IN5_V2_Init_Part, the waveform holds until the next
+    reset.
+******************************************************************************/
+void EPD_7IN5_V2_Load_Lut(const EPD_7IN5_V2_LUT *Lut)
+{
+    EPD_SendCommand(0X00);			//PANNEL SETTING
+    EPD_SendData(0x3F);   //KW-3f, LUT from register
+
+    EPD_7IN5_V2_SendLut(0x20, Lut->Vcom);
+    EPD_7IN5_V2_SendLut(0x21, Lut->WW);
+    EPD_7IN5_V2_SendLut(0x22, Lut->BW);
+    EPD_7IN5_V2_SendLut(0x23, Lut->WB);
+    EPD_7IN5_V2_SendLut(0x24, Lut->BB);
+}
+
 /*
     The feature will only be available on screens sold after 24/10/23
 */
@@ -319,11 +411,7 @@ void EPD_7IN5_V2_Load_Ram(UBYTE *blackimage)
     }
 
     EPD_SendCommand(0x13); //= 12 Display Start transmission 2 (DTM2, Red Data) (x-byte command)
-    for (UDOUBLE j = 0; j < Height; j++) {
-        for (UDOUBLE i = 0; i < Width; i++) {
-            blackimage[i + j * Width] = ~blackimage[i + j * Width];
-        }
-    }
+    Buffer_Invert(blackimage, Width * Height);
     for (UDOUBLE j = 0; j < Height; j++) {
         EPD_SendData2((UBYTE *)(blackimage+j*Width), Width);
     }
@@ -340,22 +428,12 @@ void EPD_7IN5_V2_Display(UBYTE *blackimage)
     EPD_7IN5_V2_TurnOnDisplay();
 }
 
-void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
+/******************************************************************************
+function :	Enter partial mode on a window, x in bytes, ends not included
+parameter:
+******************************************************************************/
+static void EPD_7IN5_V2_PartialWindow(UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
 {
-    if(((x_start % 8 + x_end % 8 == 8) && (x_start % 8 > x_end % 8)) || (x_start % 8 + x_end % 8 == 0) || ((x_end - x_start)%8 == 0))
-    {
-        x_start = x_start / 8 ;
-        x_end = x_end / 8;
-    }
-    else
-    {
-        x_start = x_start / 8 ;
-        x_end = x_end % 8 == 0 ? x_end / 8 : x_end / 8 + 1;
-    }
-    UWORD i, Width;
-	Width = x_end -  x_start;
-	UWORD IMAGE_COUNTER = Width * (y_end-y_start);
-
     x_end -= 1;
 	y_end -= 1;	
 
@@ -380,6 +458,25 @@ void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start
 	EPD_SendData(y_end/256);		
 	EPD_SendData(y_end%256);  //y-end
 	EPD_SendData(0x01);
+}
+
+void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
+{
+    if(((x_start % 8 + x_end % 8 == 8) && (x_start % 8 > x_end % 8)) || (x_start % 8 + x_end % 8 == 0) || ((x_end - x_start)%8 == 0))
+    {
+        x_start = x_start / 8 ;
+        x_end = x_end / 8;
+    }
+    else
+    {
+        x_start = x_start / 8 ;
+        x_end = x_end % 8 == 0 ? x_end / 8 : x_end / 8 + 1;
+    }
+    UWORD Width;
+	Width = x_end -  x_start;
+	UWORD IMAGE_COUNTER = Width * (y_end-y_start);
+
+    EPD_7IN5_V2_PartialWindow(x_start, y_start, x_end, y_end);
     
     EPD_SendCommand(0x13); //= 12 Display Start transmission 2 (DTM2, Red Data) (x-byte command)
     for (UDOUBLE j = 0; j < IMAGE_COUNTER; j++) {
@@ -388,190 +485,157 @@ void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start
     EPD_7IN5_V2_TurnOnDisplay();
 }
 
-void EPD_7IN5_V2_Display_4Gray(const UBYTE *Image)
+/******************************************************************************
+function :	Partial refresh of a window of a full frame image
+parameter:
+    image  : Frame, rows of stride bytes
+    stride : Bytes per frame row
+    x_start, x_end : Window columns, multiples of 8, x_end not included
+    y_start, y_end : Window rows, y_end not included
+******************************************************************************/
+void EPD_7IN5_V2_Display_Window(UBYTE *image, UWORD stride, UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end)
 {
-    UDOUBLE i,j,k;
-    UBYTE temp1,temp2,temp3;
+    x_start = x_start / 8;
+    x_end = (x_end + 7) / 8;
+    if (x_start >= x_end || y_start >= y_end)
+        return;
 
-    // old  data
-    EPD_SendCommand(0x10);
-    for(i=0; i<48000; i++) {
-        temp3=0;
-        for(j=0; j<2; j++) {
-            temp1 = Image[i*2+j];
-            for(k=0; k<2; k++) {
-                temp2 = temp1&0xC0;
-                if(temp2 == 0xC0)
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00)
-                    temp3 |= 0x01; 
-                else if(temp2 == 0x80)
-                    temp3 |= 0x01; 
-                else //0x40
-                    temp3 |= 0x00; 
-                temp3 <<= 1;
-
-                temp1 <<= 2;
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0) 
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00) 
-                    temp3 |= 0x01;
-                else if(temp2 == 0x80)
-                    temp3 |= 0x01; 
-                else    //0x40
-                    temp3 |= 0x00;	
-                if(j!=1 || k!=1)
-                    temp3 <<= 1;
-
-                temp1 <<= 2;
-            }
+    EPD_7IN5_V2_PartialWindow(x_start, y_start, x_end, y_end);
 
-        }
-        EPD_SendData(temp3);
-        // printf("%x",temp3);
+    EPD_SendCommand(0x13); //= 12 Display Start transmission 2 (DTM2, Red Data) (x-byte command)
+    for (UDOUBLE j = y_start; j < y_end; j++) {
+        EPD_SendData2(image + j * stride + x_start, x_end - x_start);
     }
+    EPD_7IN5_V2_TurnOnDisplay();
+}
 
-    EPD_SendCommand(0x13);   //write RAM for black(0)/white (1)
-    for(i=0; i<48000; i++) {             //5808*4  46464
-        temp3=0;
-        for(j=0; j<2; j++) {
-            temp1 = Image[i*2+j];
-            for(k=0; k<2; k++) {
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)
-                    temp3 |= 0x00;//white
-                else if(temp2 == 0x00)
-                    temp3 |= 0x01;  //black
-                else if(temp2 == 0x80)
-                    temp3 |= 0x00;  //gray1
-                else //0x40
-                    temp3 |= 0x01; //gray2
-                temp3 <<= 1;
-
-                temp1 <<= 2;
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)  //white
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00) //black
-                    temp3 |= 0x01;
-                else if(temp2 == 0x80)
-                    temp3 |= 0x00; //gray1
-                else    //0x40
-                    temp3 |= 0x01;	//gray2
-                if(j!=1 || k!=1)
-                    temp3 <<= 1;
-
-                temp1 <<= 2;
-            }
+/******************************************************************************
+function :	Plane bits of packed 4-gray bytes
+info:
+    Image bytes hold 4 pixels of 2 bits, 0x03 white, 0x02 gray1, 0x01 gray2
+    and 0x00 black. EPD_GrayLut[0] gives the 4 bits of the old data plane
+    (0x10, set for black and gray1), EPD_GrayLut[1] those of the new data
+    plane (0x13, set for black and gray2).
+******************************************************************************/
+static UBYTE EPD_GrayLut[2][256];
+static bool EPD_GrayLutReady = false;
+
+static void EPD_7IN5_V2_GrayLut(void)
+{
+    if (EPD_GrayLutReady)
+        return;
+    for (int b = 0; b < 256; b++) {
+        UBYTE old_bits = 0, new_bits = 0;
+        for (int p = 0; p < 4; p++) {
+            UBYTE v = (b >> (6 - 2 * p)) & 0x03;
+            old_bits = (old_bits << 1) | (v == 0x00 || v == 0x02);
+            new_bits = (new_bits << 1) | (v == 0x00 || v == 0x01);
         }
-        EPD_SendData(temp3);
-        // printf("%x",temp3);
+        EPD_GrayLut[0][b] = old_bits;
+        EPD_GrayLut[1][b] = new_bits;
+    }
+    EPD_GrayLutReady = true;
+}
+
+/******************************************************************************
+function :	Send one plane of a 4-gray image
+parameter:
+    Image : 2bpp rows of width pixels, 4 pixels per byte, MSB first
+    width : Image width, a multiple of 8 up to EPD_7IN5_V2_WIDTH
+    lut   : EPD_GrayLut[0] or EPD_GrayLut[1]
+info:
+    Every image byte is one table lookup, each row is built in a staging
+    buffer and sent in one transfer. Columns right of the image are 0x00.
+******************************************************************************/
+static void EPD_7IN5_V2_SendGrayPlane(const UBYTE *Image, UWORD width, const UBYTE *lut)
+{
+    UBYTE row[EPD_7IN5_V2_WIDTH / 8];
+    UWORD used = width / 8;
+
+    memset(row + used, 0x00, sizeof(row) - used);
+    for (UWORD y = 0; y < EPD_7IN5_V2_HEIGHT; y++) {
+        const UBYTE *src = Image + (UDOUBLE)y * (width / 4);
+        for (UWORD o = 0; o < used; o++)
+            row[o] = (lut[src[o * 2]] << 4) | lut[src[o * 2 + 1]];
+        EPD_SendData2(row, sizeof(row));
     }
+}
+
+void EPD_7IN5_V2_Display_4Gray(const UBYTE *Image)
+{
+    EPD_7IN5_V2_GrayLut();
+
+    EPD_SendCommand(0x10);
+    EPD_7IN5_V2_SendGrayPlane(Image, EPD_7IN5_V2_WIDTH, EPD_GrayLut[0]);
+
+    EPD_SendCommand(0x13);   //write RAM for black(0)/white (1)
+    EPD_7IN5_V2_SendGrayPlane(Image, EPD_7IN5_V2_WIDTH, EPD_GrayLut[1]);
 
     EPD_7IN5_V2_TurnOnDisplay();
 }
 
+/******************************************************************************
+function :	Display a 4-gray picture of half the panel width on the left half
+******************************************************************************/
 void EPD_7IN5_V2_WritePicture_4Gray(const UBYTE *Image)
 {
-    UDOUBLE i,j,k,o;
-    UBYTE temp1,temp2,temp3;
-    UWORD Width, Height;
-	Width = (EPD_7IN5_V2_WIDTH % 8 == 0)? (EPD_7IN5_V2_WIDTH / 8 ): (EPD_7IN5_V2_WIDTH / 8 + 1);
-	Height = EPD_7IN5_V2_HEIGHT;
+    EPD_7IN5_V2_GrayLut();
 
     EPD_SendCommand(0x10);
-    for(i=0; i<Height; i++) {
-        for(o=0; o<Width; o++) {
-            if((o < Width/2)&&(i < Height))
-            {
-                temp3=0;
-                for(j=0; j<2; j++) {
-                    temp1 = Image[(i*Width/2+o)*2+j];
-                    for(k=0; k<2; k++) {
-                        temp2 = temp1&0xC0;
-                        if(temp2 == 0xC0)
-                            temp3 |= 0x00;
-                        else if(temp2 == 0x00)
-                            temp3 |= 0x01; 
-                        else if(temp2 == 0x80)
-                            temp3 |= 0x01; 
-                        else //0x40
-                            temp3 |= 0x00; 
-                        temp3 <<= 1;
-
-                        temp1 <<= 2;
-                        temp2 = temp1&0xC0 ;
-                        if(temp2 == 0xC0) 
-                            temp3 |= 0x00;
-                        else if(temp2 == 0x00) 
-                            temp3 |= 0x01;
-                        else if(temp2 == 0x80)
-                            temp3 |= 0x01; 
-                        else    //0x40
-                            temp3 |= 0x00;	
-                        if(j!=1 || k!=1)
-                            temp3 <<= 1;
-
-                        temp1 <<= 2;
-                    }
-
-                }
-                EPD_SendData(temp3);
-                // printf("%x",temp3);
-            }
-            else
-            {
-                EPD_SendData(0x00);
-            }
-        }
-    }
-
+    EPD_7IN5_V2_SendGrayPlane(Image, EPD_7IN5_V2_WIDTH / 2, EPD_GrayLut[0]);
 
     EPD_SendCommand(0x13);
-    for(i=0; i<Height; i++) {
-        for(o=0; o<Width; o++) {
-            if((o < Width/2)&&(i < Height))
-            {
-                for(j=0; j<2; j++) {
-                    temp1 = Image[(i*Width/2+o)*2+j];
-                    for(k=0; k<2; k++) {
-                        temp2 = temp1&0xC0 ;
-                        if(temp2 == 0xC0)
-                            temp3 |= 0x00;//white
-                        else if(temp2 == 0x00)
-                            temp3 |= 0x01;  //black
-                        else if(temp2 == 0x80)
-                            temp3 |= 0x00;  //gray1
-                        else //0x40
-                            temp3 |= 0x01; //gray2
-                        temp3 <<= 1;
-
-                        temp1 <<= 2;
-                        temp2 = temp1&0xC0 ;
-                        if(temp2 == 0xC0)  //white
-                            temp3 |= 0x00;
-                        else if(temp2 == 0x00) //black
-                            temp3 |= 0x01;
-                        else if(temp2 == 0x80)
-                            temp3 |= 0x00; //gray1
-                        else    //0x40
-                            temp3 |= 0x01;	//gray2
-                        if(j!=1 || k!=1)
-                            temp3 <<= 1;
-
-                        temp1 <<= 2;
-                    }
-                }
-                EPD_SendData(temp3);
-                // printf("%x",temp3);
-            }
-            else
-            {
-                EPD_SendData(0x00);
-            }
+    EPD_7IN5_V2_SendGrayPlane(Image, EPD_7IN5_V2_WIDTH / 2, EPD_GrayLut[1]);
+
+    EPD_7IN5_V2_TurnOnDisplay();
+}
+
+/******************************************************************************
+function :	Start a streamed 4-gray image
+info:
+    For images that arrive in pieces and are not kept in memory. The old
+    data plane is sent while the image comes in, the new data plane is
+    collected by EPD_7IN5_V2_Stream_4Gray and sent by EPD_7IN5_V2_End_4Gray.
+******************************************************************************/
+void EPD_7IN5_V2_Begin_4Gray(void)
+{
+    EPD_7IN5_V2_GrayLut();
+    EPD_SendCommand(0x10);
+}
+
+/******************************************************************************
+function :	Send the next bytes of a streamed 4-gray image
+parameter:
+    Image : Packed pixels as for EPD_7IN5_V2_Display_4Gray, 800 pixels per row
+    len   : Number of bytes, even
+    Plane : Receives len / 2 bytes of the new data plane
+******************************************************************************/
+void EPD_7IN5_V2_Stream_4Gray(const UBYTE *Image, UDOUBLE len, UBYTE *Plane)
+{
+    UBYTE chunk[EPD_7IN5_V2_WIDTH / 8];
+
+    while (len >= 2) {
+        UWORD n = 0;
+        for (; n < sizeof(chunk) && len >= 2; n++, len -= 2, Image += 2) {
+            chunk[n] = (EPD_GrayLut[0][Image[0]] << 4) | EPD_GrayLut[0][Image[1]];
+            *Plane++ = (EPD_GrayLut[1][Image[0]] << 4) | EPD_GrayLut[1][Image[1]];
         }
+        EPD_SendData2(chunk, n);
     }
+}
+
+/******************************************************************************
+function :	Finish a streamed 4-gray image and refresh
+parameter:
+    Plane : The whole new data plane, EPD_7IN5_V2_WIDTH / 8 * EPD_7IN5_V2_HEIGHT bytes
+info:
+    The old data plane must be complete, 0x00 is white in both planes.
+******************************************************************************/
+void EPD_7IN5_V2_End_4Gray(UBYTE *Plane)
+{
+    EPD_SendCommand(0x13);
+    EPD_SendData2(Plane, (UDOUBLE)EPD_7IN5_V2_WIDTH / 8 * EPD_7IN5_V2_HEIGHT);
+
     EPD_7IN5_V2_TurnOnDisplay();
 }
 
@@ -40,17 +40,43 @@
 #define EPD_7IN5_V2_WIDTH       800
 #define EPD_7IN5_V2_HEIGHT      480
 
+// Frame groups of a waveform LUT, 6 bytes each
+#define EPD_7IN5_V2_LUT_GROUPS  2
+// Bytes of a LUT register, groups past a table's own are sent as 0x00
+#define EPD_7IN5_V2_LUT_SIZE    60
+
+/**
+ * Waveform for the register LUTs 0x20-0x24, see EPD_7IN5_V2_Load_Lut
+**/
+typedef struct {
+    const char *Name;
+    UBYTE Vcom[EPD_7IN5_V2_LUT_GROUPS * 6];
+    UBYTE WW[EPD_7IN5_V2_LUT_GROUPS * 6];
+    UBYTE BW[EPD_7IN5_V2_LUT_GROUPS * 6];
+    UBYTE WB[EPD_7IN5_V2_LUT_GROUPS * 6];
+    UBYTE BB[EPD_7IN5_V2_LUT_GROUPS * 6];
+} EPD_7IN5_V2_LUT;
+
+extern const EPD_7IN5_V2_LUT EPD_7IN5_V2_Luts[];
+extern const UBYTE EPD_7IN5_V2_LutCount;
+
 UBYTE EPD_7IN5_V2_Init(void);
 UBYTE EPD_7IN5_V2_Init_Fast(void);
 UBYTE EPD_7IN5_V2_Init_Part(void);
 UBYTE EPD_7IN5_V2_Init_4Gray(void);
+const EPD_7IN5_V2_LUT *EPD_7IN5_V2_Find_Lut(const char *Name);
+void EPD_7IN5_V2_Load_Lut(const EPD_7IN5_V2_LUT *Lut);
 void EPD_7IN5_V2_Clear(void);
 void EPD_7IN5_V2_ClearBlack(void);
 void EPD_7IN5_V2_Load_Ram(UBYTE *blackimage);
 void EPD_7IN5_V2_Display(UBYTE *blackimage);
 void EPD_7IN5_V2_Display_Part(UBYTE *blackimage,UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end);
+void EPD_7IN5_V2_Display_Window(UBYTE *image, UWORD stride, UDOUBLE x_start, UDOUBLE y_start, UDOUBLE x_end, UDOUBLE y_end);
 void EPD_7IN5_V2_Display_4Gray(const UBYTE *Image);
 void EPD_7IN5_V2_WritePicture_4Gray(const UBYTE *Image);
+void EPD_7IN5_V2_Begin_4Gray(void);
+void EPD_7IN5_V2_Stream_4Gray(const UBYTE *Image, UDOUBLE len, UBYTE *Plane);
+void EPD_7IN5_V2_End_4Gray(UBYTE *Plane);
 void EPD_7IN5_V2_Sleep(void);
 
 #endif
@@ -1,25 +1,77 @@
 #include "DEV_Config.h"
 #include "EPD.h"
 #include "GUI_Paint.h"
+#include "GUI_Buffer.h"
+#include "logger.h"
+#include "power.h"
+#include "env.h"
+#include "display.h"
+#include <string.h>
 
 #define HEIGHT EPD_7IN5_V2_HEIGHT
 #define WIDTH EPD_7IN5_V2_WIDTH
 
+// waveform of partial refreshes, a name from EPD_7IN5_V2_Luts or otp for the panel's own
+#ifndef ENV_PART_LUT
+#define ENV_PART_LUT otp
+#endif
+
 //
 
 UBYTE *ImageBuffer;
 
+// Deferred clear: disp_raw_begin only records the clear colour, the stream
+// marks the prefix of the buffer it has overwritten and the clear is applied
+// to the remainder right before the buffer is handed to the panel.
+static bool clearPending = false;
+static UBYTE clearPattern = WHITE;
+static UDOUBLE clearCovered = 0;
+static UDOUBLE clearSize = 0;
+
+// 4-gray frames are never held whole: the old data plane goes to the panel
+// while the stream arrives, the new data plane is collected in ImageBuffer.
+#define GRAY_FRAME_SIZE ((UDOUBLE)WIDTH / 4 * HEIGHT)
+static UDOUBLE grayReceived = 0;
+static int grayCarry = -1; // first byte of a pair split across two chunks
+
+static const char* partLutName = "otp";
+
 //
 
+static void disp_defer_clear(UWORD Color) {
+  clearPending = true;
+  clearPattern = Buffer_Pattern(Paint.Scale, Color);
+  clearCovered = 0;
+  clearSize = (UDOUBLE)Paint.WidthByte * Paint.HeightByte;
+}
+
+static void disp_apply_clear(void) {
+  if (!clearPending) {
+    return;
+  }
+  clearPending = false;
+  if (clearCovered < clearSize) {
+    Buffer_Fill(ImageBuffer + clearCovered, clearPattern, clearSize - clearCovered);
+  }
+  LOG_D("Deferred clear: %lu/%lu bytes covered", (unsigned long)clearCovered, (unsigned long)clearSize);
+}
+
+static inline UBYTE disp_reverse_bits(UBYTE b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
 int disp_init(void) {
   DEV_Module_Init();
 
-  printf("e-Paper Init and Clear...\r\n");
   // EPD_7IN5_V2_Clear();
 
   UWORD Imagesize = ((WIDTH % 8 == 0) ? (WIDTH / 8 ) : (WIDTH / 8 + 1)) * HEIGHT;
   if ((ImageBuffer = (UBYTE *)malloc(Imagesize)) == NULL) {
-    printf("Failed to apply for black memory...\r\n");
+    LOG_E("Failed to apply for black memory");
+    log_drain_serial();
     while (1);
   }
 
@@ -33,67 +85,157 @@ int disp_clear(void) {
 }
 
 int disp_print_raw(const char* text) {
-  sFONT* font = &Font24;
+  pFONT* font = &FontNoto24;
 
   EPD_7IN5_V2_Init_Part();
 
-  int w = strlen(text) * font->Width;
+  int w = Paint_TextWidth(text, font);
   int x = (WIDTH - w > 10) ? (WIDTH - w) / 2 : 0;
   int h = font->Height;
   int y = (HEIGHT - h) / 2;
 
-  Paint_NewImage(ImageBuffer, w, h, 0, WHITE);
+  // Clearing the whole frame is cheap, only the dirty region is sent
+  Paint_NewImage(ImageBuffer, WIDTH, HEIGHT, 0, WHITE);
   Paint_SelectImage(ImageBuffer);
+  clearPending = false;
   Paint_Clear(WHITE);
+  Paint_ResetDirty();
 
-  Paint_DrawString_EN(0, 0, text, font, WHITE, BLACK);
-  Paint_DrawLine(1, 1, w-1, 1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
-  Paint_DrawLine(1, h-1, w-1, h-1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
-  Paint_DrawLine(1, 1, 1, h-1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
-  Paint_DrawLine(w-1, 1, w-1, h-1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+  Paint_DrawText(x, y, text, font, BLACK, FONT_BACKGROUND);
+  Paint_DrawLine(x + 1, y + 1, x + w - 1, y + 1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+  Paint_DrawLine(x + 1, y + h - 1, x + w - 1, y + h - 1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+  Paint_DrawLine(x + 1, y + 1, x + 1, y + h - 1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+  Paint_DrawLine(x + w - 1, y + 1, x + w - 1, y + h - 1, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
 
-  int correctedX = (x % 8 == 0) ? x : x - (x % 8);
-  EPD_7IN5_V2_Display_Part(ImageBuffer, correctedX, y, correctedX + w, y + h);
+  disp_refresh_dirty();
   return 0;
 }
 
+int disp_refresh_dirty(void) {
+  int count = Paint.DirtyCount;
+  for (int i = 0; i < count; i++) {
+    const PAINT_RECT* r = &Paint.Dirty[i];
+    LOG_D("Dirty refresh %d: %u,%u %ux%u", i, r->Xstart, r->Ystart, r->Xend - r->Xstart, r->Yend - r->Ystart);
+    EPD_7IN5_V2_Display_Window(Paint.Image, Paint.WidthByte, r->Xstart, r->Ystart, r->Xend, r->Yend);
+  }
+  Paint_ResetDirty();
+  return count;
+}
+
 UBYTE* disp_raw_begin(const int w, const int h) {
   Paint_NewImage(ImageBuffer, w, h, 0, WHITE);
   Paint_SelectImage(ImageBuffer);
-  Paint_Clear(WHITE);
+  disp_defer_clear(WHITE);
   return ImageBuffer;
 }
 
 void disp_raw_stream_pixels(uint8_t* pixels, const int w, const int h, const int offset) {
+  // Byte aligned rows in the native orientation map one stream byte onto one
+  // buffer byte, only the bit order differs (stream is LSB first)
+  if (w % 8 == 0 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE && Paint.Scale == 2
+      && w == Paint.WidthMemory) {
+    if ((UDOUBLE)offset >= (UDOUBLE)Paint.WidthByte * h) {
+      return;
+    }
+    ImageBuffer[offset] = disp_reverse_bits(pixels[0]);
+    if (clearPending && (UDOUBLE)offset == clearCovered) {
+      clearCovered++;
+    }
+    return;
+  }
+
+  // Bit-wise writes merge into existing bytes, so the clear has to land first
+  disp_apply_clear();
+
   int x = 0;
   int y = 0;
   int val = 0;
+  PAINT_PIXEL_WRITER SetPixel = Paint_GetPixelWriter();
   for (int i = 0; i < 8; i++) {
     x = (offset*8 + i) % w;
     y = (offset*8 + i) / w;
     val = (pixels[0] >> i) & 1;
 
-    if (y >= h) {
+    if (y >= h || y >= Paint.Clip.Yend) {
       break;
     }
+    // The writer does no bounds checks, a stream wider than the canvas is cut
+    if (x >= Paint.Clip.Xend) {
+      continue;
+    }
 
-    Paint_SetPixel(x, y, val == 0 ? BLACK : WHITE);
+    SetPixel(&Paint, x, y, val == 0 ? BLACK : WHITE);
   }
 }
 
 void disp_raw_render_full(void) {
+  disp_apply_clear();
   EPD_7IN5_V2_Display(ImageBuffer);
+  LOG_I("Full refresh busy for %lu ms", (unsigned long)power_last_busy_ms());
   EPD_7IN5_V2_Sleep();
-  printf("Display going to sleep...\r\n");
+  LOG_D("Display going to sleep");
 }
 
 void disp_raw_render_part(int x, int y, int w, int h) {
+  disp_apply_clear();
   EPD_7IN5_V2_Display_Part(ImageBuffer, x, y, x + w, y + h);
+  LOG_I("Partial refresh busy for %lu ms (waveform %s)", (unsigned long)power_last_busy_ms(), partLutName);
   EPD_7IN5_V2_Sleep();
-  printf("Display going to sleep...\r\n");
+  LOG_D("Display going to sleep");
+}
+
+void disp_gray_begin(void) {
+  EPD_7IN5_V2_Init_4Gray();
+  EPD_7IN5_V2_Begin_4Gray();
+  // the buffer is reused for the new data plane, it no longer holds a 1bpp image
+  clearPending = false;
+  grayReceived = 0;
+  grayCarry = -1;
+}
+
+void disp_gray_stream(const uint8_t* pixels, size_t len) {
+  if (grayCarry >= 0 && len > 0 && grayReceived < GRAY_FRAME_SIZE) {
+    const UBYTE pair[2] = {(UBYTE)grayCarry, pixels[0]};
+    EPD_7IN5_V2_Stream_4Gray(pair, 2, ImageBuffer + grayReceived / 2);
+    grayReceived += 2;
+    grayCarry = -1;
+    pixels++;
+    len--;
+  }
+
+  size_t even = len & ~(size_t)1;
+  if (even > GRAY_FRAME_SIZE - grayReceived) {
+    even = GRAY_FRAME_SIZE - grayReceived;
+    len = even;
+  }
+  EPD_7IN5_V2_Stream_4Gray(pixels, even, ImageBuffer + grayReceived / 2);
+  grayReceived += even;
+  if (len > even) {
+    grayCarry = pixels[even];
+  }
+}
+
+size_t disp_gray_render(void) {
+  size_t received = grayReceived + (grayCarry >= 0 ? 1 : 0);
+  if (grayReceived < GRAY_FRAME_SIZE) {
+    // a short stream leaves the rest white: 0xFF pixel bytes, four white pixels each, are streamed in
+    LOG_W("Gray frame short: %lu/%lu bytes", (unsigned long)received, (unsigned long)GRAY_FRAME_SIZE);
+    UBYTE white[WIDTH / 4];
+    Buffer_Fill(white, 0xFF, sizeof(white));
+    while (grayReceived < GRAY_FRAME_SIZE) {
+      UDOUBLE n = GRAY_FRAME_SIZE - grayReceived < sizeof(white) ? GRAY_FRAME_SIZE - grayReceived : sizeof(white);
+      EPD_7IN5_V2_Stream_4Gray(white, n, ImageBuffer + grayReceived / 2);
+      grayReceived += n;
+    }
+  }
+  EPD_7IN5_V2_End_4Gray(ImageBuffer);
+  EPD_7IN5_V2_Sleep();
+  LOG_D("Display going to sleep");
+  return received;
 }
 
 void disp_load_ram(void) {
+  disp_apply_clear();
   EPD_7IN5_V2_Load_Ram(ImageBuffer);
 }
 
@@ -101,6 +243,17 @@ void disp_init_full(void) {
   EPD_7IN5_V2_Init();
 }
 
+void disp_init_fast(void) {
+  EPD_7IN5_V2_Init_Fast();
+}
+
 void disp_init_part(void) {
   EPD_7IN5_V2_Init_Part();
+  const EPD_7IN5_V2_LUT* lut = EPD_7IN5_V2_Find_Lut(ENV(ENV_PART_LUT));
+  if (lut != NULL) {
+    EPD_7IN5_V2_Load_Lut(lut);
+    partLutName = lut->Name;
+  } else if (strcmp(ENV(ENV_PART_LUT), "otp") != 0) {
+    LOG_W("Unknown waveform %s, using the panel's own", ENV(ENV_PART_LUT));
+  }
 }
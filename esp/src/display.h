@@ -2,12 +2,17 @@
 #ifndef _DISPLAY_H_
 #define _DISPLAY_H_
 
+// refresh mode byte of the image header
+#define REFRESH_NORMAL 0  // slow full refresh, clears ghosting
+#define REFRESH_FAST 1    // fast full refresh
+#define REFRESH_PARTIAL 2 // partial refresh of a bounding box
 
 extern int disp_init(void);
 
 extern int disp_clear(void);
 
 extern int disp_print_raw(const char* text);
+extern int disp_refresh_dirty(void);
 
 extern UBYTE* disp_raw_begin(const int w, const int h);
 extern void disp_raw_stream_pixels(uint8_t* pixels, const int w, const int h, const int offset);
@@ -16,7 +21,13 @@ extern void disp_raw_render_full(void);
 extern void disp_raw_render_part(int x, int y, int w, int h);
 extern void disp_load_ram(void);
 
+// 4-gray frame, packed 2bpp pixels MSB first, 0 black .. 3 white
+extern void disp_gray_begin(void);
+extern void disp_gray_stream(const uint8_t* pixels, size_t len);
+extern size_t disp_gray_render(void);
+
 extern void disp_init_full(void);
+extern void disp_init_fast(void);
 extern void disp_init_part(void);
 
 #endif
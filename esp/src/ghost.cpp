@@ -0,0 +1,102 @@
+#include "ghost.h"
+#include "logger.h"
+#include <esp_attr.h>
+
+/**
+ * Panel history since the last clean (slow full) refresh. Partial and fast refreshes leave ghosting that
+ * adds up with their count and the area they change, and partials in the cold leave more.
+ */
+typedef struct {
+  bool known;
+  uint16_t partials;
+  uint16_t coldPartials;
+  uint8_t fastFulls;
+  uint32_t pixels;
+  uint32_t cleanMinutes;
+} ghost_history_t;
+
+// zeroed on power on, the panel content is unknown until the first clean refresh
+RTC_DATA_ATTR static ghost_history_t history;
+
+static bool cold = false;
+
+//
+
+/**
+ * Temperature of this wake, partials drawn below ENV_GHOST_COLD_C count twice.
+ */
+void ghost_temperature(float temperature) {
+  cold = temperature < ENV_GHOST_COLD_C;
+}
+
+void ghost_partial(uint32_t pixels) {
+  if (history.partials < 0xFFFF) {
+    history.partials++;
+  }
+  if (cold && history.coldPartials < 0xFFFF) {
+    history.coldPartials++;
+  }
+  history.pixels = pixels > UINT32_MAX - history.pixels ? UINT32_MAX : history.pixels + pixels;
+}
+
+void ghost_fast_full(void) {
+  if (history.fastFulls < 0xFF) {
+    history.fastFulls++;
+  }
+}
+
+void ghost_clean(uint32_t nowMinutes) {
+  history.known = true;
+  history.partials = 0;
+  history.coldPartials = 0;
+  history.fastFulls = 0;
+  history.pixels = 0;
+  history.cleanMinutes = nowMinutes;
+}
+
+bool ghost_clean_due(uint32_t nowMinutes) {
+  if (!history.known) {
+    return true;
+  }
+  if ((uint32_t) history.partials + history.coldPartials >= ENV_GHOST_MAX_PARTIALS) {
+    return true;
+  }
+  if (history.pixels >= ENV_GHOST_MAX_AREA) {
+    return true;
+  }
+  if (history.fastFulls >= ENV_GHOST_MAX_FAST) {
+    return true;
+  }
+  bool touched = history.partials > 0 || history.fastFulls > 0;
+  return touched && nowMinutes - history.cleanMinutes >= ENV_GHOST_MAX_MINUTES;
+}
+
+/**
+ * Writes the history and whether a clean refresh is due, the server picks the refresh mode from it.
+ */
+size_t ghost_encode(uint8_t* out, size_t cap, uint32_t nowMinutes) {
+  if (cap < GHOST_RECORD_SIZE) {
+    return 0;
+  }
+
+  bool due = ghost_clean_due(nowMinutes);
+  uint32_t minutes = history.known ? nowMinutes - history.cleanMinutes : 0;
+  LOG_D("Ghost history: %u partials (%u cold), %u fast, %lu px", history.partials, history.coldPartials,
+        history.fastFulls, history.pixels);
+
+  out[0] = (history.known ? GHOST_FLAG_KNOWN : 0) | (due ? GHOST_FLAG_DUE : 0);
+  out[1] = history.partials >> 8;
+  out[2] = history.partials & 0xFF;
+  out[3] = history.coldPartials >> 8;
+  out[4] = history.coldPartials & 0xFF;
+  out[5] = history.fastFulls;
+  out[6] = history.pixels >> 24;
+  out[7] = (history.pixels >> 16) & 0xFF;
+  out[8] = (history.pixels >> 8) & 0xFF;
+  out[9] = history.pixels & 0xFF;
+  out[10] = minutes >> 24;
+  out[11] = (minutes >> 16) & 0xFF;
+  out[12] = (minutes >> 8) & 0xFF;
+  out[13] = minutes & 0xFF;
+  return GHOST_RECORD_SIZE;
+}
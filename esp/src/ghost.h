@@ -0,0 +1,46 @@
+#ifndef _GHOST_H_
+#define _GHOST_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// weighted partial refreshes until a clean refresh is due, partials in the cold count twice
+#ifndef ENV_GHOST_MAX_PARTIALS
+#define ENV_GHOST_MAX_PARTIALS 24
+#endif
+
+// pixels changed by partial refreshes until a clean refresh is due
+#ifndef ENV_GHOST_MAX_AREA
+#define ENV_GHOST_MAX_AREA 768000
+#endif
+
+// fast full refreshes until a clean refresh is due
+#ifndef ENV_GHOST_MAX_FAST
+#define ENV_GHOST_MAX_FAST 6
+#endif
+
+// minutes a partial or fast refresh may stay on screen before a clean refresh
+#ifndef ENV_GHOST_MAX_MINUTES
+#define ENV_GHOST_MAX_MINUTES 360
+#endif
+
+// degrees celsius below which partial refreshes leave more ghosting
+#ifndef ENV_GHOST_COLD_C
+#define ENV_GHOST_COLD_C 10
+#endif
+
+#define GHOST_FLAG_KNOWN 0x01 // history covers every refresh since the last clean one
+#define GHOST_FLAG_DUE 0x02   // a clean refresh is due
+
+// history on the wire: u8 flags, u16 partials, u16 cold partials, u8 fast fulls, u32 pixels, u32 minutes
+#define GHOST_RECORD_SIZE 14
+
+extern void ghost_temperature(float temperature);
+extern void ghost_partial(uint32_t pixels);
+extern void ghost_fast_full(void);
+extern void ghost_clean(uint32_t nowMinutes);
+
+extern bool ghost_clean_due(uint32_t nowMinutes);
+extern size_t ghost_encode(uint8_t* out, size_t cap, uint32_t nowMinutes);
+
+#endif
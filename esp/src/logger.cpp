@@ -0,0 +1,124 @@
+#include "logger.h"
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#include <esp_app_desc.h>
+#define log_app_elf_sha256 esp_app_get_elf_sha256
+#else
+#include <esp_ota_ops.h>
+#define log_app_elf_sha256 esp_ota_get_app_elf_sha256
+#endif
+
+#define LOG_MAGIC 0x4C4F4731
+
+typedef struct {
+  uint32_t magic;
+  uint32_t build; // records point into the image that wrote them
+  uint16_t head;
+  uint16_t count;
+  uint16_t wake;
+  log_record_t records[LOG_RING_SIZE];
+} log_ring_t;
+
+// survives deep sleep and soft resets, validated by the magic and the build id on every boot
+RTC_NOINIT_ATTR static log_ring_t ring;
+
+static const char levelTags[] = { '-', 'E', 'W', 'I', 'D' };
+
+//
+
+/**
+ * Hash of the running image's elf sha256. Rtc memory survives a reflash or an ota reset, records written by
+ * another image hold format pointers into that image and must not be formatted.
+ */
+static uint32_t log_build_id(void) {
+  char sha[65];
+  log_app_elf_sha256(sha, sizeof(sha));
+  uint32_t hash = 2166136261u;
+  for (const char* c = sha; *c; c++) {
+    hash = (hash ^ (uint8_t) *c) * 16777619u;
+  }
+  return hash;
+}
+
+void log_init(bool coldBoot) {
+  uint32_t build = log_build_id();
+  if (ring.magic != LOG_MAGIC || ring.build != build || ring.head >= LOG_RING_SIZE || ring.count > LOG_RING_SIZE) {
+    ring.magic = LOG_MAGIC;
+    ring.build = build;
+    ring.head = 0;
+    ring.count = 0;
+    ring.wake = 0;
+  }
+  ring.wake++;
+
+  // a reset with the monitor attached is how a developer asks for the logs
+  if (coldBoot && ring.count > 0) {
+    log_drain_serial();
+  }
+}
+
+void log_write(uint8_t level, const char* fmt, uint8_t argc, const uint32_t* args) {
+  log_record_t* rec = &ring.records[ring.head];
+  rec->fmt = fmt;
+  rec->ms = millis();
+  rec->wake = ring.wake;
+  rec->level = level;
+  rec->argc = argc;
+  for (uint8_t i = 0; i < LOG_MAX_ARGS; i++) {
+    rec->args[i] = i < argc ? args[i] : 0;
+  }
+
+  ring.head = (ring.head + 1) % LOG_RING_SIZE;
+  if (ring.count < LOG_RING_SIZE) {
+    ring.count++;
+  }
+
+#if ENV_LOG_ECHO
+  char line[160];
+  log_format(rec, line, sizeof(line));
+  Serial.println(line);
+#endif
+}
+
+uint16_t log_count(void) {
+  return ring.count;
+}
+
+const log_record_t* log_get(uint16_t index) {
+  if (index >= ring.count) {
+    return NULL;
+  }
+  return &ring.records[(ring.head + LOG_RING_SIZE - ring.count + index) % LOG_RING_SIZE];
+}
+
+/**
+ * Renders one record as "[wake ms L] message", returns the length written.
+ */
+size_t log_format(const log_record_t* rec, char* out, size_t cap) {
+  char tag = rec->level < sizeof(levelTags) ? levelTags[rec->level] : '?';
+  int len = snprintf(out, cap, "[%u %lu %c] ", rec->wake, (unsigned long) rec->ms, tag);
+  if (len < 0 || (size_t) len >= cap) {
+    return cap - 1;
+  }
+  int msg = snprintf(out + len, cap - len, rec->fmt, rec->args[0], rec->args[1], rec->args[2], rec->args[3]);
+  if (msg < 0) {
+    return len;
+  }
+  return (size_t) (len + msg) >= cap ? cap - 1 : len + msg;
+}
+
+void log_drain_serial(void) {
+  char line[160];
+  for (uint16_t i = 0; i < ring.count; i++) {
+    log_format(log_get(i), line, sizeof(line));
+    Serial.println(line);
+  }
+  log_clear();
+}
+
+void log_clear(void) {
+  ring.head = 0;
+  ring.count = 0;
+}
@@ -0,0 +1,82 @@
+#ifndef _LOGGER_H_
+#define _LOGGER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+// calls above this level compile to nothing
+#ifndef ENV_LOG_LEVEL
+#define ENV_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// also print every record to serial right away, for development only
+#ifndef ENV_LOG_ECHO
+#define ENV_LOG_ECHO 0
+#endif
+
+#define LOG_RING_SIZE 64
+#define LOG_MAX_ARGS 4
+
+/**
+ * Log records are not formatted when written. They store the address of the format string, which lives in flash
+ * and stays valid across deep sleep, plus up to LOG_MAX_ARGS integer arguments. Arguments are taken as 32 bit
+ * integers, %s only works with string literals.
+ */
+typedef struct {
+  const char* fmt;
+  uint32_t args[LOG_MAX_ARGS];
+  uint32_t ms;
+  uint16_t wake;
+  uint8_t level;
+  uint8_t argc;
+} log_record_t;
+
+extern void log_init(bool coldBoot);
+extern void log_write(uint8_t level, const char* fmt, uint8_t argc, const uint32_t* args);
+
+extern uint16_t log_count(void);
+extern size_t log_format(const log_record_t* rec, char* out, size_t cap);
+extern const log_record_t* log_get(uint16_t index);
+extern void log_drain_serial(void);
+extern void log_clear(void);
+
+template<typename T> static inline uint32_t log_arg(T v) { return (uint32_t) v; }
+static inline uint32_t log_arg(const char* v) { return (uint32_t) (uintptr_t) v; }
+
+template<typename... A> static inline void log_record(uint8_t level, const char* fmt, A... args) {
+  static_assert(sizeof...(A) <= LOG_MAX_ARGS, "too many log arguments");
+  const uint32_t values[LOG_MAX_ARGS + 1] = { log_arg(args)... };
+  log_write(level, fmt, sizeof...(A), values);
+}
+
+#if ENV_LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(fmt, ...) log_record(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define LOG_E(fmt, ...) do {} while (0)
+#endif
+
+#if ENV_LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(fmt, ...) log_record(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+#define LOG_W(fmt, ...) do {} while (0)
+#endif
+
+#if ENV_LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(fmt, ...) log_record(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define LOG_I(fmt, ...) do {} while (0)
+#endif
+
+#if ENV_LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(fmt, ...) log_record(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define LOG_D(fmt, ...) do {} while (0)
+#endif
+
+#endif
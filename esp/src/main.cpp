@@ -2,8 +2,13 @@
 #include "EPD.h"
 #include "display.h"
 #include "env.h"
-#include <Wire.h>
-#include <Adafruit_BMP085.h>
+#include "sensor.h"
+#include "telemetry.h"
+#include "profile.h"
+#include "ghost.h"
+#include "network.h"
+#include "logger.h"
+#include "power.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include <esp_sleep.h>
@@ -13,60 +18,117 @@ const char* WIFI_PASS = ENV(ENV_WIFI_PASS);
 const char* IMG_URL = ENV(ENV_IMG_HOST);
 const char* DEV_ID = ENV(ENV_DEV_ID);
 
-Adafruit_BMP085 bmp;
+RTC_DATA_ATTR uint32_t clockMinutes = 0; // minutes slept since power on
+RTC_DATA_ATTR uint16_t fetchMinutesLeft = 0; // minutes until the next image request is due
+
+const char* refresh_mode_name(uint8_t mode) {
+  switch (mode) {
+    case REFRESH_NORMAL: return "normal";
+    case REFRESH_FAST: return "fast";
+    case REFRESH_PARTIAL: return "partial";
+    default: return "unknown";
+  }
+}
+
+void sleep_for(uint16_t minutes) {
+  // wake up in between to keep sampling the sensor
+  uint16_t nap = minutes < ENV_SENSOR_INTERVAL ? minutes : ENV_SENSOR_INTERVAL;
+  fetchMinutesLeft = minutes - nap;
+  clockMinutes += nap;
+
+  LOG_D("Entering deep sleep for %u minutes (%u until next request)", nap, fetchMinutesLeft);
+  esp_sleep_enable_timer_wakeup(nap * 60 * 1000000ULL);
+  esp_deep_sleep_start();
+}
+
+// the server asks for the log ring with a response header, it is sent as plain text right after the image
+void upload_logs(void) {
+  String text;
+  char line[160];
+  for (uint16_t i = 0; i < log_count(); i++) {
+    log_format(log_get(i), line, sizeof(line));
+    text += line;
+    text += '\n';
+  }
+
+  char fullUrl[256];
+  snprintf(fullUrl, sizeof(fullUrl), "http://%s:3034/l", IMG_URL);
+
+  HTTPClient http;
+  http.begin(fullUrl);
+  http.addHeader("Content-Type", "text/plain");
+  int httpCode = http.POST(text);
+  if (httpCode >= 200 && httpCode < 300) {
+    log_clear();
+  }
+  http.end();
+}
 
 void setup() {
   Serial.begin(115200);
-  Serial.println("Booting...");
+  log_init(esp_reset_reason() != ESP_RST_DEEPSLEEP);
+  LOG_D("Booting");
 
-  disp_init();
-  delay(500);
-  Serial.println("Display initialized.");
-
-  if (!bmp.begin()) {
-    Serial.println("BMP085 sensor init failed!");
+  if (!sensor_init()) {
+    LOG_E("BMP085 sensor init failed");
   } else {
-    Serial.println("BMP085 sensor initialized.");
-  }
+    sensor_sample(clockMinutes);
+    LOG_D("BMP085 sample buffered (%u pending)", sensor_count());
 
-  Serial.print("Connecting to WiFi: ");
-  Serial.println(WIFI_SSID);
-  WiFi.begin(WIFI_SSID, WIFI_PASS);
+    float temperature;
+    int32_t pressure;
+    if (sensor_latest(&temperature, &pressure)) {
+      ghost_temperature(temperature);
+    }
+  }
 
-  unsigned long start = millis();
-  while (WiFi.status() != WL_CONNECTED && millis() - start < 10000) {
-    delay(500);
-    Serial.print(".");
+  // sensor only wake, the server does not expect us yet
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER && fetchMinutesLeft > 0) {
+    sleep_for(fetchMinutesLeft);
   }
-  Serial.println();
+
+  power_init();
+  disp_init();
+  delay(500);
+  LOG_D("Display initialized");
+
+  prof_enter(PROF_WIFI);
+  bool connected = net_connect(WIFI_SSID, WIFI_PASS, ENV_WIFI_TIMEOUT);
 
   uint8_t sleepMinutes = 5;
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("WiFi connected.");
-    float temp = bmp.readTemperature();
-    Serial.print("Temperature: ");
-    Serial.println(temp);
+  if (connected) {
+    LOG_I("WiFi connected after %lu ms", millis());
+    prof_enter(PROF_HTTP);
+
+    uint8_t body[TELEM_MAX_SIZE];
+    size_t bodyLen = telem_build(body, sizeof(body), clockMinutes);
 
     char fullUrl[256];
-    snprintf(fullUrl, sizeof(fullUrl), "http://%s:3034/r?temp=%.2f", IMG_URL, temp);
-    Serial.print("Requesting image from: ");
-    Serial.println(fullUrl);
+    snprintf(fullUrl, sizeof(fullUrl), "http://%s:3034/r", IMG_URL);
 
+    const char* responseHeaders[] = { "X-Log-Drain" };
     HTTPClient http;
     http.begin(fullUrl);
-    int httpCode = http.GET();
-    Serial.print("HTTP GET response: ");
-    Serial.println(httpCode);
+    http.collectHeaders(responseHeaders, 1);
+    http.addHeader("Content-Type", "application/octet-stream");
+    int httpCode = http.POST(body, bodyLen);
+    bool drainLogs = http.header("X-Log-Drain") == "1";
+    LOG_I("HTTP POST response: %d (%u bytes telemetry)", httpCode, bodyLen);
 
     if (httpCode >= 200 && httpCode < 300) {
+      // the server has the samples now
+      sensor_clear();
+
       WiFiClient* stream = http.getStreamPtr();
+      prof_enter(PROF_STREAM);
+      uint32_t streamStart = millis();
 
-      Serial.println("Started image streaming...");
 
       int headPosition = 0; // position in the stream (only updated when reading header)
       int writePosition = 0; // position in the display buffer
 
       uint8_t opCode = 99; // 99 is invalid opcode
+      uint8_t refreshMode = REFRESH_NORMAL;
       uint16_t partialBoundingX = 0;
       uint16_t partialBoundingY = 0;
       uint16_t partialBoundingW = 0;
@@ -84,28 +146,30 @@ void setup() {
           continue;
         }
 
+        // the socket wait runs at the low clock, decoding the chunk does not
+        PowerBoost boost;
+
         if (headPosition == 0 && len > buffPosition) {
           uint8_t header = buffer[buffPosition];
           buffPosition++;
           headPosition++;
           if ((header >> 3) != 0b11101) {
-            Serial.println("Invalid magic number header, aborting...");
+            LOG_E("Invalid magic number header 0x%02x, aborting", header);
             break;
           }
 
           opCode = header & 0b111;
 
           if (opCode == 0) {
-            Serial.println("Op: Noop");
+            LOG_I("Op: Noop");
           } else if (opCode == 1) {
-            Serial.println("Op: Full");
-            disp_init_full();
-            disp_raw_begin(800, 480);
-            headerComplete = true;
+            LOG_I("Op: Full");
           } else if (opCode == 2) {
-            Serial.println("Op: Part");
+            LOG_I("Op: Part");
+          } else if (opCode == 3) {
+            LOG_I("Op: Gray");
           } else {
-            Serial.printf("Unknown opcode: %u, skipping...\n", opCode);
+            LOG_E("Unknown opcode: %u, skipping", opCode);
             break;
           }
         }
@@ -118,7 +182,7 @@ void setup() {
           if (sleepMinutes == 0 || sleepMinutes > 4*60) {
             sleepMinutes = 10;
           }
-          Serial.printf("Sleep minutes set to: %u\n", sleepMinutes);
+          LOG_D("Sleep minutes set to: %u", sleepMinutes);
 
           if (opCode == 0) {
             headerComplete = true;
@@ -126,59 +190,88 @@ void setup() {
           }
         }
 
+        // refresh mode requested by the server, the opcode decides what is possible
+        if (headPosition == 2 && len > buffPosition) {
+          uint8_t requested = buffer[buffPosition];
+          buffPosition++;
+          headPosition++;
+          if (opCode == 2) {
+            refreshMode = REFRESH_PARTIAL;
+          } else if (opCode == 1 && requested == REFRESH_FAST && !ghost_clean_due(clockMinutes)) {
+            refreshMode = REFRESH_FAST;
+          } else {
+            // a fast refresh would add to the ghosting when a clean one is due anyway
+            refreshMode = REFRESH_NORMAL;
+          }
+          LOG_I("Refresh mode: %s (requested %s)", refresh_mode_name(refreshMode), refresh_mode_name(requested));
+
+          if (opCode == 1) {
+            if (refreshMode == REFRESH_FAST) {
+              disp_init_fast();
+            } else {
+              disp_init_full();
+            }
+            disp_raw_begin(800, 480);
+            headerComplete = true;
+          } else if (opCode == 3) {
+            disp_gray_begin();
+            headerComplete = true;
+          }
+        }
+
         // if we are doing a partial update, we need to read the bounding box
         if (opCode == 2) {
-          if (headPosition == 2 && len > buffPosition) {
+          if (headPosition == 3 && len > buffPosition) {
             partialBoundingX = buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 3 && len > buffPosition) {
+          if (headPosition == 4 && len > buffPosition) {
             partialBoundingX = (partialBoundingX << 8) | buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 4 && len > buffPosition) {
+          if (headPosition == 5 && len > buffPosition) {
             partialBoundingY = buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 5 && len > buffPosition) {
+          if (headPosition == 6 && len > buffPosition) {
             partialBoundingY = (partialBoundingY << 8) | buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 6 && len > buffPosition) {
+          if (headPosition == 7 && len > buffPosition) {
             partialBoundingW = buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 7 && len > buffPosition) {
+          if (headPosition == 8 && len > buffPosition) {
             partialBoundingW = (partialBoundingW << 8) | buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 8 && len > buffPosition) {
+          if (headPosition == 9 && len > buffPosition) {
             partialBoundingH = buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 9 && len > buffPosition) {
+          if (headPosition == 10 && len > buffPosition) {
             partialBoundingH = (partialBoundingH << 8) | buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 10 && len > buffPosition) {
+          if (headPosition == 11 && len > buffPosition) {
             previousImageBlockSize = buffer[buffPosition];
             buffPosition++;
             headPosition++;
           }
-          if (headPosition == 11 && len > buffPosition) {
+          if (headPosition == 12 && len > buffPosition) {
             previousImageBlockSize = (previousImageBlockSize << 8) | buffer[buffPosition];
             buffPosition++;
             headPosition++;
 
-            printf("Partial bounding box: x=%u, y=%u, w=%u, h=%u\n", partialBoundingX, partialBoundingY, partialBoundingW, partialBoundingH);
+            LOG_I("Partial bounding box: x=%u, y=%u, w=%u, h=%u", partialBoundingX, partialBoundingY, partialBoundingW, partialBoundingH);
             disp_init_full();
             disp_raw_begin(800, 480);
             headerComplete = true;
@@ -192,7 +285,13 @@ void setup() {
 
         // data left to read but header not complete... this should never happen
         if (!headerComplete) {
-          Serial.println("Header not complete, waiting for more data...");
+          LOG_W("Header not complete, waiting for more data");
+          continue;
+        }
+
+        // gray pixels go through in bulk, straight to the panel
+        if (opCode == 3) {
+          disp_gray_stream(&buffer[buffPosition], len - buffPosition);
           continue;
         }
 
@@ -213,7 +312,7 @@ void setup() {
                 disp_init_part();
                 disp_raw_begin(partialBoundingW, partialBoundingH);
                 prevImageComplete = true;
-                Serial.println("Previous image complete, starting partial update.");
+                LOG_D("Previous image complete, starting partial update");
               }
             }
           } else {
@@ -223,27 +322,47 @@ void setup() {
       }
 
       if (!headerComplete) {
-        Serial.println("Header not complete, image rendering aborted.");
+        LOG_E("Header not complete, image rendering aborted");
       } else if (opCode == 1) {
+        prof_enter(PROF_REFRESH);
         disp_raw_render_full();
-        Serial.println("Full image rendered.");
+        if (refreshMode == REFRESH_FAST) {
+          ghost_fast_full();
+        } else {
+          ghost_clean(clockMinutes);
+        }
+        LOG_I("Full image rendered");
       } else if (opCode == 2) {
+        prof_enter(PROF_REFRESH);
         disp_raw_render_part(partialBoundingX, partialBoundingY, partialBoundingW, partialBoundingH);
-        Serial.println("Partial image rendered.");
+        ghost_partial((uint32_t)partialBoundingW * partialBoundingH);
+        LOG_I("Partial image rendered");
+      } else if (opCode == 3) {
+        uint32_t streamMs = millis() - streamStart;
+        prof_enter(PROF_REFRESH);
+        size_t received = disp_gray_render();
+        // the 4-gray waveform drives every pixel like a clean refresh
+        ghost_clean(clockMinutes);
+        // memory cost is the 1bpp frame buffer that holds the new data plane
+        LOG_I("Gray image rendered: %u bytes streamed in %lu ms, %u bytes buffered", (unsigned)received, (unsigned long)streamMs, 800 / 8 * 480);
       }
     } else {
-      Serial.println("Failed to download image.");
+      LOG_E("Failed to download image (HTTP %d)", httpCode);
     }
     http.end();
+
+    if (drainLogs) {
+      upload_logs();
+    }
   } else {
-    Serial.println("WiFi connection failed.");
+    LOG_E("WiFi connection failed (reason %u)", net_last_reason());
   }
 
+  prof_enter(PROF_SLEEP);
   WiFi.disconnect(true);
-  Serial.printf("Entering deep sleep for %u minutes...\n", sleepMinutes);
   delay(500);
-  esp_sleep_enable_timer_wakeup(sleepMinutes * 60 * 1000000ULL);
-  esp_deep_sleep_start();
+  prof_finish();
+  sleep_for(sleepMinutes);
 }
 
 void loop() {}
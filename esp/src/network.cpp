@@ -0,0 +1,109 @@
+#include "network.h"
+#include "profile.h"
+#include "logger.h"
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+#define WIFI_BIT_GOT_IP BIT0
+#define WIFI_BIT_FAILED BIT1
+
+static EventGroupHandle_t wifiEvents = NULL;
+static volatile uint32_t attemptStart = 0;
+static volatile uint8_t lastReason = 0;
+static volatile uint8_t suspectFailures = 0;
+
+// attempts are recorded from the event task and handed to the profile once the wait is over
+static volatile uint16_t attemptMs[PROF_MAX_WIFI_ATTEMPTS];
+static volatile uint8_t attemptReason[PROF_MAX_WIFI_ATTEMPTS];
+static volatile uint8_t attempts = 0;
+
+//
+
+// the ap rejected the credentials, retrying cannot help
+static bool net_reason_is_rejection(uint8_t reason) {
+  switch (reason) {
+    case WIFI_REASON_AUTH_FAIL:
+    case WIFI_REASON_AUTH_EXPIRE:
+    case WIFI_REASON_802_1X_AUTH_FAILED:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// often transient (a missed scan right after wake, a weak signal), but a wrong psk also ends in a handshake timeout
+static bool net_reason_is_suspect(uint8_t reason) {
+  switch (reason) {
+    case WIFI_REASON_NO_AP_FOUND:
+    case WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT:
+    case WIFI_REASON_HANDSHAKE_TIMEOUT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static void net_record_attempt(uint8_t reason) {
+  uint32_t now = millis();
+  if (attempts < PROF_MAX_WIFI_ATTEMPTS) {
+    attemptMs[attempts] = now - attemptStart;
+    attemptReason[attempts] = reason;
+    attempts++;
+  }
+  attemptStart = now;
+}
+
+static void net_on_event(arduino_event_id_t event, arduino_event_info_t info) {
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    net_record_attempt(0);
+    xEventGroupSetBits(wifiEvents, WIFI_BIT_GOT_IP);
+  } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+    lastReason = info.wifi_sta_disconnected.reason;
+    net_record_attempt(lastReason);
+    // transient failures are retried by the auto reconnect, rejected credentials are not worth the wait
+    // and neither is an ap that stays missing or a handshake that keeps timing out
+    if (net_reason_is_suspect(lastReason)) {
+      suspectFailures++;
+    }
+    if (net_reason_is_rejection(lastReason) || suspectFailures >= ENV_WIFI_SUSPECT_LIMIT) {
+      xEventGroupSetBits(wifiEvents, WIFI_BIT_FAILED);
+    }
+  }
+}
+
+bool net_connect(const char* ssid, const char* pass, uint32_t timeoutMs) {
+  if (wifiEvents == NULL) {
+    wifiEvents = xEventGroupCreate();
+    WiFi.onEvent(net_on_event);
+  }
+  xEventGroupClearBits(wifiEvents, WIFI_BIT_GOT_IP | WIFI_BIT_FAILED);
+  attempts = 0;
+  lastReason = 0;
+  suspectFailures = 0;
+
+  attemptStart = millis();
+  WiFi.begin(ssid, pass);
+
+  EventBits_t bits = xEventGroupWaitBits(wifiEvents, WIFI_BIT_GOT_IP | WIFI_BIT_FAILED, pdFALSE, pdFALSE, pdMS_TO_TICKS(timeoutMs));
+  if (!(bits & (WIFI_BIT_GOT_IP | WIFI_BIT_FAILED))) {
+    // timed out while still trying, 0xFF marks the attempt as unfinished
+    net_record_attempt(0xFF);
+  }
+
+  for (uint8_t i = 0; i < attempts; i++) {
+    LOG_D("WiFi attempt %u: %u ms, reason %u", i, attemptMs[i], attemptReason[i]);
+    prof_wifi_attempt(attemptMs[i], attemptReason[i]);
+  }
+
+  if (bits & WIFI_BIT_GOT_IP) {
+    return true;
+  }
+
+  WiFi.disconnect(true);
+  return false;
+}
+
+uint8_t net_last_reason(void) {
+  return lastReason;
+}
@@ -0,0 +1,19 @@
+#ifndef _NETWORK_H_
+#define _NETWORK_H_
+
+#include <stdint.h>
+
+// give up connecting after this many milliseconds
+#ifndef ENV_WIFI_TIMEOUT
+#define ENV_WIFI_TIMEOUT 10000
+#endif
+
+// give up early after this many missing ap or handshake timeout disconnects
+#ifndef ENV_WIFI_SUSPECT_LIMIT
+#define ENV_WIFI_SUSPECT_LIMIT 3
+#endif
+
+extern bool net_connect(const char* ssid, const char* pass, uint32_t timeoutMs);
+extern uint8_t net_last_reason(void);
+
+#endif
@@ -0,0 +1,114 @@
+#include "power.h"
+#include "logger.h"
+#include "DEV_Config.h"
+#include <Arduino.h>
+#include <sdkconfig.h>
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t boostLock = NULL;
+#endif
+static bool pmActive = false;
+
+static uint8_t boostCount = 0;
+static bool phaseHigh = true;
+static bool busyWait = false;
+static uint32_t busyStart = 0;
+static uint32_t busyLastMs = 0;
+static bool clockHigh = true;
+
+//
+
+/**
+ * Applies the clock wanted by the current phase, active boosts and panel busy waits.
+ * With power management active the frequency follows a pm lock, otherwise the cpu is switched directly.
+ * A switch that fails leaves the clock state alone, so the next call tries again.
+ */
+static void power_apply(void) {
+  bool high = !busyWait && (phaseHigh || boostCount > 0);
+  if (high == clockHigh) {
+    return;
+  }
+
+  bool switched;
+#if CONFIG_PM_ENABLE
+  if (pmActive) {
+    switched = (high ? esp_pm_lock_acquire(boostLock) : esp_pm_lock_release(boostLock)) == ESP_OK;
+  } else
+#endif
+  {
+    switched = setCpuFrequencyMhz(high ? ENV_CPU_HIGH_MHZ : ENV_CPU_LOW_MHZ);
+  }
+  if (!switched) {
+    return;
+  }
+
+  clockHigh = high;
+  prof_clock(!high);
+}
+
+void power_init(void) {
+#if CONFIG_PM_ENABLE
+  esp_pm_config_esp32_t config = {
+    .max_freq_mhz = ENV_CPU_HIGH_MHZ,
+    .min_freq_mhz = ENV_CPU_LOW_MHZ,
+    .light_sleep_enable = false
+  };
+  pmActive = esp_pm_configure(&config) == ESP_OK
+    && esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "boost", &boostLock) == ESP_OK
+    && esp_pm_lock_acquire(boostLock) == ESP_OK;
+  if (!pmActive) {
+    LOG_E("Power management unavailable, switching the cpu clock directly");
+  }
+#endif
+  if (!pmActive) {
+    setCpuFrequencyMhz(ENV_CPU_HIGH_MHZ);
+  }
+  clockHigh = true;
+}
+
+void power_phase(prof_phase_t phase) {
+  switch (phase) {
+    case PROF_WIFI:
+    case PROF_HTTP:
+    case PROF_STREAM:
+    case PROF_SLEEP:
+      phaseHigh = false;
+      break;
+    default:
+      phaseHigh = true;
+      break;
+  }
+  power_apply();
+}
+
+void power_boost(void) {
+  boostCount++;
+  power_apply();
+}
+
+void power_release(void) {
+  if (boostCount > 0) {
+    boostCount--;
+  }
+  power_apply();
+}
+
+// overrides the weak hooks of the epd driver
+void DEV_Busy_Begin(void) {
+  busyWait = true;
+  busyStart = millis();
+  power_apply();
+}
+
+void DEV_Busy_End(void) {
+  busyWait = false;
+  busyLastMs = millis() - busyStart;
+  power_apply();
+}
+
+uint32_t power_last_busy_ms(void) {
+  return busyLastMs;
+}
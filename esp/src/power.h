@@ -0,0 +1,33 @@
+#ifndef _POWER_H_
+#define _POWER_H_
+
+#include <stdint.h>
+#include "profile.h"
+
+// clock while waiting on the network or the panel, wifi needs at least 80MHz
+#ifndef ENV_CPU_LOW_MHZ
+#define ENV_CPU_LOW_MHZ 80
+#endif
+
+// clock while decoding the stream or pushing data over spi
+#ifndef ENV_CPU_HIGH_MHZ
+#define ENV_CPU_HIGH_MHZ 240
+#endif
+
+extern void power_init(void);
+extern void power_phase(prof_phase_t phase);
+
+// nestable, keeps the high clock until every boost is released
+extern void power_boost(void);
+extern void power_release(void);
+
+// length of the last panel busy wait, after a refresh that is the refresh itself
+extern uint32_t power_last_busy_ms(void);
+
+// boosts until the end of the scope
+struct PowerBoost {
+  PowerBoost() { power_boost(); }
+  ~PowerBoost() { power_release(); }
+};
+
+#endif
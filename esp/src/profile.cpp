@@ -0,0 +1,102 @@
+#include "profile.h"
+#include "logger.h"
+#include "power.h"
+#include <Arduino.h>
+#include <esp_attr.h>
+
+static prof_t current = {};
+static prof_phase_t currentPhase = PROF_BOOT;
+static uint32_t phaseStart = 0;
+static bool lowClock = false;
+static uint32_t lowStart = 0;
+
+RTC_DATA_ATTR static prof_t last;
+RTC_DATA_ATTR static bool lastValid = false;
+
+static const char* phaseNames[PROF_COUNT] = { "boot", "wifi", "http", "stream", "refresh", "sleep" };
+
+//
+
+void prof_enter(prof_phase_t phase) {
+  uint32_t now = millis();
+  current.phaseMs[currentPhase] += now - phaseStart;
+  if (lowClock) {
+    current.phaseLowMs[currentPhase] += now - lowStart;
+    lowStart = now;
+  }
+  currentPhase = phase;
+  phaseStart = now;
+
+  power_phase(phase);
+}
+
+void prof_clock(bool low) {
+  uint32_t now = millis();
+  if (lowClock) {
+    current.phaseLowMs[currentPhase] += now - lowStart;
+  }
+  lowClock = low;
+  lowStart = now;
+}
+
+void prof_wifi_attempt(uint32_t ms, uint8_t reason) {
+  if (current.wifiAttempts >= PROF_MAX_WIFI_ATTEMPTS) {
+    return;
+  }
+  current.wifiAttemptMs[current.wifiAttempts] = ms > 0xFFFF ? 0xFFFF : ms;
+  current.wifiAttemptReason[current.wifiAttempts] = reason;
+  current.wifiAttempts++;
+}
+
+void prof_finish(void) {
+  prof_enter(PROF_SLEEP);
+  last = current;
+  lastValid = true;
+
+  for (int i = 0; i < PROF_COUNT; i++) {
+    LOG_D("Profile %s: %lu ms, %lu ms at low clock", phaseNames[i], current.phaseMs[i], current.phaseLowMs[i]);
+  }
+}
+
+bool prof_last(prof_t* out) {
+  if (!lastValid) {
+    return false;
+  }
+  *out = last;
+  return true;
+}
+
+/**
+ * Phase durations and their low clock share (u32 each) followed by the wifi attempt count and per attempt latency (u16) and reason (u8).
+ */
+size_t prof_encode(uint8_t* out, size_t cap) {
+  if (!lastValid) {
+    return 0;
+  }
+
+  size_t len = 1 + PROF_COUNT * 8 + 1 + last.wifiAttempts * 3;
+  if (len > cap) {
+    return 0;
+  }
+
+  uint8_t* p = out;
+  *p++ = PROF_COUNT;
+  for (int i = 0; i < PROF_COUNT; i++) {
+    *p++ = last.phaseMs[i] >> 24;
+    *p++ = last.phaseMs[i] >> 16;
+    *p++ = last.phaseMs[i] >> 8;
+    *p++ = last.phaseMs[i] & 0xFF;
+    *p++ = last.phaseLowMs[i] >> 24;
+    *p++ = last.phaseLowMs[i] >> 16;
+    *p++ = last.phaseLowMs[i] >> 8;
+    *p++ = last.phaseLowMs[i] & 0xFF;
+  }
+  *p++ = last.wifiAttempts;
+  for (int i = 0; i < last.wifiAttempts; i++) {
+    *p++ = last.wifiAttemptMs[i] >> 8;
+    *p++ = last.wifiAttemptMs[i] & 0xFF;
+    *p++ = last.wifiAttemptReason[i];
+  }
+
+  return len;
+}
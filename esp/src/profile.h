@@ -0,0 +1,39 @@
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+  PROF_BOOT = 0,
+  PROF_WIFI,
+  PROF_HTTP,
+  PROF_STREAM,
+  PROF_REFRESH,
+  PROF_SLEEP,
+  PROF_COUNT
+} prof_phase_t;
+
+#define PROF_MAX_WIFI_ATTEMPTS 4
+
+/**
+ * Wake profile, time spent per phase of one connected wake.
+ * The last finished profile is kept in rtc memory and uploaded with the next request.
+ */
+typedef struct {
+  uint32_t phaseMs[PROF_COUNT];
+  uint32_t phaseLowMs[PROF_COUNT]; // part of phaseMs spent at the low cpu clock
+  uint16_t wifiAttemptMs[PROF_MAX_WIFI_ATTEMPTS];
+  uint8_t wifiAttemptReason[PROF_MAX_WIFI_ATTEMPTS];
+  uint8_t wifiAttempts;
+} prof_t;
+
+extern void prof_enter(prof_phase_t phase);
+extern void prof_clock(bool low);
+extern void prof_wifi_attempt(uint32_t ms, uint8_t reason);
+extern void prof_finish(void);
+
+extern bool prof_last(prof_t* out);
+extern size_t prof_encode(uint8_t* out, size_t cap);
+
+#endif
@@ -0,0 +1,96 @@
+#include "sensor.h"
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_BMP085.h>
+#include <esp_attr.h>
+
+typedef struct {
+  uint32_t minutes;
+  int16_t centiDegrees;
+  int32_t pressure;
+} sensor_record_t;
+
+RTC_DATA_ATTR static sensor_record_t ring[SENSOR_RING_SIZE];
+RTC_DATA_ATTR static uint8_t ringHead = 0;
+RTC_DATA_ATTR static uint8_t ringCount = 0;
+
+static Adafruit_BMP085 bmp;
+static bool bmpReady = false;
+
+//
+
+bool sensor_init(void) {
+  bmpReady = bmp.begin(ENV_SENSOR_MODE);
+  return bmpReady;
+}
+
+bool sensor_sample(uint32_t nowMinutes) {
+  if (!bmpReady) {
+    return false;
+  }
+
+  sensor_record_t* rec = &ring[ringHead];
+  rec->minutes = nowMinutes;
+  rec->centiDegrees = (int16_t) lroundf(bmp.readTemperature() * 100.0f);
+  rec->pressure = bmp.readPressure();
+
+  ringHead = (ringHead + 1) % SENSOR_RING_SIZE;
+  if (ringCount < SENSOR_RING_SIZE) {
+    ringCount++;
+  }
+  return true;
+}
+
+uint8_t sensor_count(void) {
+  return ringCount;
+}
+
+bool sensor_latest(float* temperature, int32_t* pressure) {
+  if (ringCount == 0) {
+    return false;
+  }
+
+  sensor_record_t* rec = &ring[(ringHead + SENSOR_RING_SIZE - 1) % SENSOR_RING_SIZE];
+  *temperature = rec->centiDegrees / 100.0f;
+  *pressure = rec->pressure;
+  return true;
+}
+
+/**
+ * Writes all buffered samples oldest first, prefixed by the oversampling mode and the sample count.
+ * Returns the number of bytes written or 0 if the samples do not fit into out.
+ */
+size_t sensor_encode(uint8_t* out, size_t cap, uint32_t nowMinutes) {
+  size_t len = 2 + ringCount * SENSOR_RECORD_SIZE;
+  if (len > cap) {
+    return 0;
+  }
+
+  out[0] = ENV_SENSOR_MODE;
+  out[1] = ringCount;
+
+  uint8_t* p = out + 2;
+  for (uint8_t i = 0; i < ringCount; i++) {
+    sensor_record_t* rec = &ring[(ringHead + SENSOR_RING_SIZE - ringCount + i) % SENSOR_RING_SIZE];
+    uint32_t age = nowMinutes - rec->minutes;
+    int32_t pressure = rec->pressure - SENSOR_PRESSURE_BASE;
+    if (age > 0xFFFF) age = 0xFFFF;
+    if (pressure < 0) pressure = 0;
+    if (pressure > 0xFFFF) pressure = 0xFFFF;
+
+    p[0] = age >> 8;
+    p[1] = age & 0xFF;
+    p[2] = (uint16_t) rec->centiDegrees >> 8;
+    p[3] = (uint16_t) rec->centiDegrees & 0xFF;
+    p[4] = pressure >> 8;
+    p[5] = pressure & 0xFF;
+    p += SENSOR_RECORD_SIZE;
+  }
+
+  return len;
+}
+
+void sensor_clear(void) {
+  ringHead = 0;
+  ringCount = 0;
+}
@@ -0,0 +1,32 @@
+#ifndef _SENSOR_H_
+#define _SENSOR_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// BMP085 oversampling mode (0 = ultra low power ... 3 = ultra high res)
+#ifndef ENV_SENSOR_MODE
+#define ENV_SENSOR_MODE 1
+#endif
+
+// minutes between two sensor samples, the device wakes at least this often
+#ifndef ENV_SENSOR_INTERVAL
+#define ENV_SENSOR_INTERVAL 5
+#endif
+
+// samples kept in rtc memory until the next successful upload
+#define SENSOR_RING_SIZE 64
+
+// one sample on the wire: u16 age in minutes, i16 centi degrees, u16 pascal above SENSOR_PRESSURE_BASE
+#define SENSOR_RECORD_SIZE 6
+#define SENSOR_PRESSURE_BASE 50000
+
+extern bool sensor_init(void);
+extern bool sensor_sample(uint32_t nowMinutes);
+
+extern uint8_t sensor_count(void);
+extern bool sensor_latest(float* temperature, int32_t* pressure);
+extern size_t sensor_encode(uint8_t* out, size_t cap, uint32_t nowMinutes);
+extern void sensor_clear(void);
+
+#endif
@@ -0,0 +1,40 @@
+#include "telemetry.h"
+#include "sensor.h"
+#include "profile.h"
+#include "ghost.h"
+
+static size_t telem_section(uint8_t* out, size_t cap, uint8_t type, size_t len) {
+  if (len == 0 || len > 0xFFFF || cap < 3) {
+    return 0;
+  }
+  out[0] = type;
+  out[1] = len >> 8;
+  out[2] = len & 0xFF;
+  return 3 + len;
+}
+
+size_t telem_build(uint8_t* out, size_t cap, uint32_t nowMinutes) {
+  if (cap < 1) {
+    return 0;
+  }
+
+  size_t pos = 0;
+  out[pos++] = TELEM_VERSION;
+
+  if (sensor_count() > 0 && cap - pos > 3) {
+    size_t len = sensor_encode(out + pos + 3, cap - pos - 3, nowMinutes);
+    pos += telem_section(out + pos, cap - pos, TELEM_SECTION_SENSOR, len);
+  }
+
+  if (cap - pos > 3) {
+    size_t len = prof_encode(out + pos + 3, cap - pos - 3);
+    pos += telem_section(out + pos, cap - pos, TELEM_SECTION_PROFILE, len);
+  }
+
+  if (cap - pos > 3) {
+    size_t len = ghost_encode(out + pos + 3, cap - pos - 3, nowMinutes);
+    pos += telem_section(out + pos, cap - pos, TELEM_SECTION_GHOST, len);
+  }
+
+  return pos;
+}
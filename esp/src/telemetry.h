@@ -0,0 +1,20 @@
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Telemetry is uploaded as the POST body of the image request:
+ * one version byte, then sections of [type u8][length u16][payload]
+ */
+#define TELEM_VERSION 1
+#define TELEM_MAX_SIZE 512
+
+#define TELEM_SECTION_SENSOR 0x01
+#define TELEM_SECTION_PROFILE 0x02
+#define TELEM_SECTION_GHOST 0x03
+
+extern size_t telem_build(uint8_t* out, size_t cap, uint32_t nowMinutes);
+
+#endif
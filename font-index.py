@@ -0,0 +1,60 @@
+"""Generate sorted code point indexes for the cFONT tables.
+
+For every esp/lib/esp32-waveshare-epd/src/font*CN.c this writes font*CN_index.h
+next to it, which the font file includes. Runs before each PlatformIO build
+and can be run by hand: python3 font-index.py
+"""
+import glob
+import os
+import re
+
+try:
+  Import("env")  # noqa: F821 - defined when PlatformIO runs this as a pre script
+except NameError:
+  pass
+
+FONT_DIR = os.path.join("esp", "lib", "esp32-waveshare-epd", "src")
+ENTRY_RE = re.compile(r'\{\s*"((?:[^"\\]|\\.)*)"\s*,')
+
+
+def entries(source, name):
+  table = source.split(name + "_Table[]", 1)[1].split("};", 1)[0]
+  # drop the /*-- ... --*/ glyph comments, they quote the glyphs too
+  table = re.sub(r"/\*.*?\*/", "", table, flags=re.S)
+  return [m.group(1) for m in ENTRY_RE.finditer(table)]
+
+
+def build(path):
+  name = os.path.basename(path)[:-2]
+  name = name[0].upper() + name[1:]
+  with open(path, encoding="utf-8") as f:
+    source = f.read()
+
+  index = {}
+  for entry, text in enumerate(entries(source, name)):
+    if len(text.encode("utf-8")) > 3 or len(text) != 1:
+      raise SystemExit("{}: entry {} '{}' is not one character of at most 3 UTF-8 bytes".format(path, entry, text))
+    # DrawString_CN used the first match, keep that one
+    index.setdefault(ord(text), entry)
+
+  lines = [
+    "/* Generated by font-index.py from {}, do not edit */".format(os.path.basename(path)),
+    "static const CH_CN_INDEX {}_Index[] = {{".format(name),
+  ]
+  for code in sorted(index):
+    lines.append("  {{0x{:04X}, {:3d}}}, /* {} */".format(code, index[code], chr(code) if code > 0x20 else ""))
+  lines.append("};")
+  out = "\n".join(lines) + "\n"
+
+  target = path[:-2] + "_index.h"
+  if os.path.isfile(target):
+    with open(target, encoding="utf-8", newline="") as f:
+      if f.read() == out:
+        return
+  with open(target, "w", encoding="utf-8", newline="") as f:
+    f.write(out)
+  print("font-index: wrote {} ({} glyphs)".format(target, len(index)))
+
+
+for path in sorted(glob.glob(os.path.join(FONT_DIR, "font*CN.c"))):
+  build(path)
@@ -0,0 +1,443 @@
+"""Pack the TrueType fonts in assets/ into proportional pFONT tables.
+
+Each entry of FONTS becomes esp/lib/esp32-waveshare-epd/src/<file>. Glyphs are
+rendered with FreeType in monochrome, cropped to their ink and stored with
+their rows bit packed, kerning comes from the 'kern' feature of the GPOS
+table. Compressed fonts store each glyph as alternating white and black run
+lengths of its rows XORed with the row above, Huffman coded with one code
+per colour. Needs the FreeType shared library (libfreetype6, brew install
+freetype) and is run by hand after changing FONTS: python3 font-pack.py
+
+python3 font-pack.py --raw DIR writes uncompressed copies of FONTS to DIR
+instead, named <C name>Raw, for the glyph benchmark in
+esp/lib/esp32-waveshare-epd/host.
+"""
+import ctypes
+import ctypes.util
+import heapq
+import os
+import struct
+import sys
+
+ASSET_DIR = "assets"
+FONT_DIR = os.path.join("esp", "lib", "esp32-waveshare-epd", "src")
+
+# printable ASCII and Latin-1, enough for the German and French calendar titles,
+# plus the ellipsis Text_Layout ends cut lines with
+CHARSET = [range(0x20, 0x7F), range(0xA0, 0x100), [0x2026]]
+
+FONTS = [
+  # ttf, pixel size, C name, output file, compressed
+  # the 16 px body text saves too little flash to pay for decoding each glyph
+  ("NotoSans.ttf", 16, "FontNoto16", "fontNoto16.cpp", False),
+  ("NotoSans.ttf", 24, "FontNoto24", "fontNoto24.cpp", True),
+]
+
+# pHUFFMAN limits, a run symbol of RUN_ESCAPE adds that much and reads on
+CODE_BITS = 15
+RUN_ESCAPE = 63
+
+FT_LOAD_RENDER = 1 << 2
+FT_LOAD_FORCE_AUTOHINT = 1 << 5
+FT_LOAD_TARGET_MONO = 2 << 16
+FT_PIXEL_MODE_MONO = 1
+
+
+class FT_Generic(ctypes.Structure):
+  _fields_ = [("data", ctypes.c_void_p), ("finalizer", ctypes.c_void_p)]
+
+
+class FT_Bitmap(ctypes.Structure):
+  _fields_ = [
+    ("rows", ctypes.c_uint), ("width", ctypes.c_uint), ("pitch", ctypes.c_int),
+    ("buffer", ctypes.POINTER(ctypes.c_ubyte)), ("num_grays", ctypes.c_ushort),
+    ("pixel_mode", ctypes.c_ubyte), ("palette_mode", ctypes.c_ubyte), ("palette", ctypes.c_void_p),
+  ]
+
+
+class FT_GlyphSlotRec(ctypes.Structure):
+  _fields_ = [
+    ("library", ctypes.c_void_p), ("face", ctypes.c_void_p), ("next", ctypes.c_void_p),
+    ("glyph_index", ctypes.c_uint), ("generic", FT_Generic),
+    ("metrics", ctypes.c_long * 8), ("linearHoriAdvance", ctypes.c_long), ("linearVertAdvance", ctypes.c_long),
+    ("advance", ctypes.c_long * 2), ("format", ctypes.c_uint), ("bitmap", FT_Bitmap),
+    ("bitmap_left", ctypes.c_int), ("bitmap_top", ctypes.c_int),
+  ]
+
+
+class FT_SizeRec(ctypes.Structure):
+  _fields_ = [
+    ("face", ctypes.c_void_p), ("generic", FT_Generic),
+    ("x_ppem", ctypes.c_ushort), ("y_ppem", ctypes.c_ushort), ("x_scale", ctypes.c_long), ("y_scale", ctypes.c_long),
+    ("ascender", ctypes.c_long), ("descender", ctypes.c_long), ("height", ctypes.c_long), ("max_advance", ctypes.c_long),
+  ]
+
+
+class FT_FaceRec(ctypes.Structure):
+  _fields_ = [
+    ("num_faces", ctypes.c_long), ("face_index", ctypes.c_long), ("face_flags", ctypes.c_long),
+    ("style_flags", ctypes.c_long), ("num_glyphs", ctypes.c_long),
+    ("family_name", ctypes.c_char_p), ("style_name", ctypes.c_char_p),
+    ("num_fixed_sizes", ctypes.c_int), ("available_sizes", ctypes.c_void_p),
+    ("num_charmaps", ctypes.c_int), ("charmaps", ctypes.c_void_p), ("generic", FT_Generic),
+    ("bbox", ctypes.c_long * 4), ("units_per_EM", ctypes.c_ushort),
+    ("ascender", ctypes.c_short), ("descender", ctypes.c_short), ("height", ctypes.c_short),
+    ("max_advance_width", ctypes.c_short), ("max_advance_height", ctypes.c_short),
+    ("underline_position", ctypes.c_short), ("underline_thickness", ctypes.c_short),
+    ("glyph", ctypes.POINTER(FT_GlyphSlotRec)), ("size", ctypes.POINTER(FT_SizeRec)),
+  ]
+
+
+def load_freetype():
+  path = ctypes.util.find_library("freetype")
+  if not path:
+    raise SystemExit("font-pack: FreeType library not found")
+  ft = ctypes.CDLL(path)
+  ft.FT_New_Face.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_long, ctypes.POINTER(ctypes.POINTER(FT_FaceRec))]
+  ft.FT_Set_Pixel_Sizes.argtypes = [ctypes.POINTER(FT_FaceRec), ctypes.c_uint, ctypes.c_uint]
+  ft.FT_Load_Char.argtypes = [ctypes.POINTER(FT_FaceRec), ctypes.c_ulong, ctypes.c_int32]
+  ft.FT_Get_Char_Index.argtypes = [ctypes.POINTER(FT_FaceRec), ctypes.c_ulong]
+  ft.FT_Get_Char_Index.restype = ctypes.c_uint
+  library = ctypes.c_void_p()
+  if ft.FT_Init_FreeType(ctypes.byref(library)):
+    raise SystemExit("font-pack: FT_Init_FreeType failed")
+  return ft, library
+
+
+def u16(data, offset):
+  return struct.unpack_from(">H", data, offset)[0]
+
+
+def s16(data, offset):
+  return struct.unpack_from(">h", data, offset)[0]
+
+
+def coverage(data, offset):
+  """Glyph id -> coverage index"""
+  out = {}
+  if u16(data, offset) == 1:
+    for i in range(u16(data, offset + 2)):
+      out[u16(data, offset + 4 + 2 * i)] = i
+  else:
+    for i in range(u16(data, offset + 2)):
+      start, end, index = struct.unpack_from(">HHH", data, offset + 4 + 6 * i)
+      for glyph in range(start, end + 1):
+        out[glyph] = index + glyph - start
+  return out
+
+
+def class_def(data, offset):
+  """Glyph id -> class, missing glyphs are class 0"""
+  out = {}
+  if u16(data, offset) == 1:
+    start = u16(data, offset + 2)
+    for i in range(u16(data, offset + 4)):
+      out[start + i] = u16(data, offset + 6 + 2 * i)
+  else:
+    for i in range(u16(data, offset + 2)):
+      start, end, value = struct.unpack_from(">HHH", data, offset + 4 + 6 * i)
+      for glyph in range(start, end + 1):
+        out[glyph] = value
+  return out
+
+
+def x_advance(data, offset, value_format):
+  """XAdvance of a value record, 0 when the format has none"""
+  if not value_format & 0x4:
+    return 0
+  return s16(data, offset + 2 * bin(value_format & 0x3).count("1"))
+
+
+def pair_subtable(data, offset, glyphs):
+  """Kerning of one PairPos subtable as {(first, second): units}"""
+  out = {}
+  fmt, cov, vf1, vf2 = struct.unpack_from(">HHHH", data, offset)
+  covered = coverage(data, offset + cov)
+  size1 = 2 * bin(vf1).count("1")
+  size2 = 2 * bin(vf2).count("1")
+  if fmt == 1:
+    for first in glyphs:
+      if first not in covered:
+        continue
+      pair_set = offset + u16(data, offset + 10 + 2 * covered[first])
+      for i in range(u16(data, pair_set)):
+        record = pair_set + 2 + i * (2 + size1 + size2)
+        second = u16(data, record)
+        if second in glyphs:
+          out[(first, second)] = x_advance(data, record + 2, vf1)
+  elif fmt == 2:
+    classes1 = class_def(data, offset + u16(data, offset + 8))
+    classes2 = class_def(data, offset + u16(data, offset + 10))
+    count2 = u16(data, offset + 14)
+    for first in glyphs:
+      if first not in covered:
+        continue
+      for second in glyphs:
+        record = offset + 16 + (classes1.get(first, 0) * count2 + classes2.get(second, 0)) * (size1 + size2)
+        out[(first, second)] = x_advance(data, record, vf1)
+  return out
+
+
+def kerning(path, glyphs):
+  """Sum of the GPOS 'kern' lookups in font units for pairs of glyph ids"""
+  with open(path, "rb") as f:
+    data = f.read()
+  tables = {}
+  for i in range(u16(data, 4)):
+    tag, _, offset, _ = struct.unpack_from(">4sIII", data, 12 + 16 * i)
+    tables[tag] = offset
+  if b"GPOS" not in tables:
+    return {}
+  gpos = tables[b"GPOS"]
+  features = gpos + u16(data, gpos + 6)
+  lookups = gpos + u16(data, gpos + 8)
+
+  indices = set()
+  for i in range(u16(data, features)):
+    tag, offset = struct.unpack_from(">4sH", data, features + 2 + 6 * i)
+    if tag == b"kern":
+      feature = features + offset
+      for j in range(u16(data, feature + 2)):
+        indices.add(u16(data, feature + 4 + 2 * j))
+
+  total = {}
+  for index in sorted(indices):
+    lookup = lookups + u16(data, lookups + 2 + 2 * index)
+    lookup_type = u16(data, lookup)
+    applied = {}
+    for i in range(u16(data, lookup + 4)):
+      subtable = lookup + u16(data, lookup + 6 + 2 * i)
+      kind = lookup_type
+      if kind == 9:
+        kind = u16(data, subtable + 2)
+        subtable += struct.unpack_from(">I", data, subtable + 4)[0]
+      if kind != 2:
+        continue
+      # the first subtable holding a pair applies, later ones are skipped
+      for pair, value in pair_subtable(data, subtable, glyphs).items():
+        applied.setdefault(pair, value)
+    for pair, value in applied.items():
+      total[pair] = total.get(pair, 0) + value
+  return total
+
+
+def render(ft, face, code):
+  """Monochrome glyph as (rows of 0/1, left, top, advance), cropped to its ink"""
+  # the bundled fonts carry no usable hinting, the autohinter keeps stems even
+  if ft.FT_Load_Char(face, code, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO | FT_LOAD_FORCE_AUTOHINT):
+    raise SystemExit("font-pack: cannot render U+{:04X}".format(code))
+  slot = face.contents.glyph.contents
+  bitmap = slot.bitmap
+  if bitmap.rows and bitmap.pixel_mode != FT_PIXEL_MODE_MONO:
+    raise SystemExit("font-pack: U+{:04X} did not render in monochrome".format(code))
+  rows = []
+  for y in range(bitmap.rows):
+    line = bitmap.buffer[y * bitmap.pitch:y * bitmap.pitch + (bitmap.width + 7) // 8]
+    rows.append([(line[x // 8] >> (7 - x % 8)) & 1 for x in range(bitmap.width)])
+  left, top = slot.bitmap_left, slot.bitmap_top
+
+  while rows and not any(rows[0]):
+    rows.pop(0)
+    top -= 1
+  while rows and not any(rows[-1]):
+    rows.pop()
+  while rows and not any(row[0] for row in rows):
+    rows = [row[1:] for row in rows]
+    left += 1
+  while rows and not any(row[-1] for row in rows):
+    rows = [row[:-1] for row in rows]
+  return rows, left, top, (slot.advance[0] + 32) >> 6
+
+
+def glyph_runs(rows):
+  """Alternating white and black runs of the rows XORed with the row above"""
+  prev = [0] * len(rows[0])
+  bits = []
+  for row in rows:
+    bits += [a ^ b for a, b in zip(row, prev)]
+    prev = row
+  runs, color, length = [], 0, 0
+  for bit in bits:
+    if bit == color:
+      length += 1
+    else:
+      runs.append(length)
+      color, length = bit, 1
+  runs.append(length)
+  return runs
+
+
+def run_symbols(run):
+  return [RUN_ESCAPE] * (run // RUN_ESCAPE) + [run % RUN_ESCAPE]
+
+
+def huffman(freq):
+  """Canonical code as (counts per length, symbols in code order, {symbol: (code, length)})"""
+  while True:
+    lengths = dict.fromkeys(freq, 0)
+    heap = [(f, i, [symbol]) for i, (symbol, f) in enumerate(sorted(freq.items()))]
+    heapq.heapify(heap)
+    while len(heap) > 1:
+      f1, i, s1 = heapq.heappop(heap)
+      f2, _, s2 = heapq.heappop(heap)
+      for symbol in s1 + s2:
+        lengths[symbol] += 1
+      heapq.heappush(heap, (f1 + f2, i, s1 + s2))
+    if len(lengths) == 1:
+      lengths = dict.fromkeys(lengths, 1)
+    if max(lengths.values()) <= CODE_BITS:
+      break
+    # too deep, flatten the statistics and try again
+    freq = {symbol: (f + 1) // 2 for symbol, f in freq.items()}
+
+  order = sorted(lengths, key=lambda symbol: (lengths[symbol], symbol))
+  counts = [0] * (CODE_BITS + 1)
+  codes = {}
+  code = length = 0
+  for symbol in order:
+    code <<= lengths[symbol] - length
+    length = lengths[symbol]
+    counts[length] += 1
+    codes[symbol] = (code, length)
+    code += 1
+  return counts, order, codes
+
+
+def compress(images):
+  """Huffman coded runs of each glyph, as (streams, [white code, black code])"""
+  runs = [glyph_runs(rows) if rows else [] for rows in images]
+  freq = [{}, {}]
+  for glyph in runs:
+    for i, run in enumerate(glyph):
+      for symbol in run_symbols(run):
+        freq[i % 2][symbol] = freq[i % 2].get(symbol, 0) + 1
+  tables = [huffman(f or {0: 1}) for f in freq]
+
+  streams = []
+  for glyph in runs:
+    bits = []
+    for i, run in enumerate(glyph):
+      for symbol in run_symbols(run):
+        code, length = tables[i % 2][2][symbol]
+        bits += [(code >> (length - 1 - j)) & 1 for j in range(length)]
+    streams.append(bits)
+  return streams, tables
+
+
+def glyph_name(code):
+  if code == 0x27 or code == 0x5C:
+    return "'\\{}'".format(chr(code))
+  if code < 0x7F:
+    return "'{}'".format(chr(code))
+  return "U+{:04X} {}".format(code, chr(code)) if code > 0xA0 else "U+{:04X}".format(code)
+
+
+def build(ft, library, ttf, size, name, filename, compressed, font_dir=FONT_DIR):
+  path = os.path.join(ASSET_DIR, ttf)
+  face = ctypes.POINTER(FT_FaceRec)()
+  if ft.FT_New_Face(library, path.encode(), 0, ctypes.byref(face)):
+    raise SystemExit("font-pack: cannot open " + path)
+  ft.FT_Set_Pixel_Sizes(face, 0, size)
+  metrics = face.contents.size.contents
+  ascent = (metrics.ascender + 32) >> 6
+  height = (metrics.height + 32) >> 6
+  units = face.contents.units_per_EM
+
+  codes = [code for chars in CHARSET for code in chars if ft.FT_Get_Char_Index(face, code)]
+  ranges = []
+  for code in codes:
+    if ranges and ranges[-1][0] + ranges[-1][1] == code:
+      ranges[-1][1] += 1
+    else:
+      ranges.append([code, 1, len([c for c in codes if c < code])])
+
+  rendered = [render(ft, face, code) for code in codes]
+  images = [rows for rows, _, _, _ in rendered]
+  if compressed:
+    streams, tables = compress(images)
+  else:
+    streams = [[bit for row in rows for bit in row] for rows in images]
+
+  bitmap = bytearray()
+  glyphs = []
+  for code, (rows, left, top, advance), bits in zip(codes, rendered, streams):
+    width = len(rows[0]) if rows else 0
+    offset = len(bitmap)
+    for i in range(0, len(bits), 8):
+      chunk = bits[i:i + 8] + [0] * (8 - len(bits[i:i + 8]))
+      bitmap.append(sum(bit << (7 - j) for j, bit in enumerate(chunk)))
+    if offset > 0xFFFF or width > 0xFF or len(rows) > 0xFF or advance > 0xFF:
+      raise SystemExit("font-pack: {} is too large for pGLYPH".format(name))
+    glyphs.append((offset, width, len(rows), advance, left, ascent - top, code))
+  if not compressed:
+    # rows are read two bytes at a time, the last glyph must not run off the table
+    bitmap.append(0)
+
+  ids = {ft.FT_Get_Char_Index(face, code): i for i, code in enumerate(codes)}
+  pairs = []
+  for (first, second), value in kerning(path, ids).items():
+    pixels = int(round(value * size / units))
+    if pixels:
+      pairs.append((ids[first], ids[second], pixels))
+  pairs.sort()
+
+  out = ["/* Generated by font-pack.py from {} at {} px, do not edit */".format(ttf, size), '#include "fonts.h"', ""]
+  out.append("static const uint8_t {}_Bitmap[] = {{".format(name))
+  for i in range(0, len(bitmap), 16):
+    out.append("  " + " ".join("0x{:02X},".format(b) for b in bitmap[i:i + 16]))
+  out += ["};", ""]
+  out.append("static const pGLYPH {}_Glyphs[] = {{".format(name))
+  out.append("  /* offset, width, height, advance, left, top */")
+  for offset, width, rows, advance, left, top, code in glyphs:
+    out.append("  {{{:5d}, {:2d}, {:2d}, {:2d}, {:2d}, {:2d}}}, /* {} */".format(
+      offset, width, rows, advance, left, top, glyph_name(code)))
+  out += ["};", ""]
+  out.append("static const pRANGE {}_Ranges[] = {{".format(name))
+  for first, count, glyph in ranges:
+    out.append("  {{0x{:04X}, {:3d}, {:3d}}},".format(first, count, glyph))
+  out += ["};", ""]
+  if pairs:
+    out.append("static const pKERN {}_Kerning[] = {{".format(name))
+    for first, second, pixels in pairs:
+      out.append("  {{{:3d}, {:3d}, {:2d}}}, /* {} {} */".format(
+        first, second, pixels, glyph_name(codes[first]), glyph_name(codes[second])))
+    out += ["};", ""]
+  if compressed:
+    out.append("static const pHUFFMAN {}_Runs[2] = {{".format(name))
+    for color, (counts, order, _) in zip(("white", "black"), tables):
+      out.append("  { /* %s runs */" % color)
+      out.append("    {" + ", ".join(str(c) for c in counts) + "},")
+      symbols = order + [0] * (RUN_ESCAPE + 1 - len(order))
+      for i in range(0, len(symbols), 16):
+        out.append(("    {" if i == 0 else "     ") + ", ".join("{:2d}".format(v) for v in symbols[i:i + 16])
+                   + ("}," if i + 16 >= len(symbols) else ","))
+      out.append("  },")
+    out += ["};", ""]
+  out.append("pFONT {} = {{".format(name))
+  out.append("  {}_Bitmap,".format(name))
+  out.append("  {}_Glyphs,".format(name))
+  out.append("  {}_Ranges,".format(name))
+  out.append("  sizeof({0}_Ranges) / sizeof(pRANGE),".format(name))
+  out.append("  {}_Kerning,".format(name) if pairs else "  0, /* no kerning */")
+  out.append("  sizeof({0}_Kerning) / sizeof(pKERN),".format(name) if pairs else "  0,")
+  out.append("  {}, /* Height */".format(height))
+  out.append("  {}, /* Ascent */".format(ascent))
+  out.append("  {}_Runs,".format(name) if compressed else "  0, /* not compressed */")
+  out.append("};")
+  text = "\n".join(out) + "\n"
+
+  target = os.path.join(font_dir, filename)
+  with open(target, "w", encoding="utf-8", newline="") as f:
+    f.write(text)
+  flash = len(bitmap) + 8 * len(glyphs) + 8 * len(ranges) + 6 * len(pairs) + (160 if compressed else 0)
+  print("font-pack: wrote {} ({} glyphs, {} kerning pairs, about {} bytes)".format(
+    target, len(glyphs), len(pairs), flash))
+
+
+ft, library = load_freetype()
+if sys.argv[1:2] == ["--raw"] and len(sys.argv) == 3:
+  for ttf, size, name, filename, _ in FONTS:
+    build(ft, library, ttf, size, name + "Raw", filename.replace(".cpp", "Raw.cpp"), False, sys.argv[2])
+else:
+  for font in FONTS:
+    build(ft, library, *font)